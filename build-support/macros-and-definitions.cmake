@@ -1138,6 +1138,11 @@ macro(process_options)
   # types
   if(${NS3_LOG} OR (${build_profile} STREQUAL "debug"))
     add_definitions(-DNS3_LOG_ENABLE)
+    # Compile out the log messages above the requested level
+    if(NOT ("${NS3_LOG_LEVEL}" STREQUAL ""))
+      string(TOUPPER ${NS3_LOG_LEVEL} log_level)
+      add_definitions(-DNS_LOG_STATIC_LEVEL=ns3::LOG_LEVEL_${log_level})
+    endif()
   endif()
   # Force enable ns-3 asserts in debug builds and if requested for other build
   # types
@@ -157,6 +157,7 @@ RoutingProtocol::RoutingProtocol()
       m_destinationOnly(false),
       m_gratuitousReply(true),
       m_enableHello(false),
+      m_timerCoalescing(false),
       m_routingTable(m_deletePeriod),
       m_queue(m_maxQueueLen, m_maxQueueTime),
       m_requestId(0),
@@ -323,6 +324,13 @@ RoutingProtocol::GetTypeId()
                           MakeBooleanAccessor(&RoutingProtocol::SetBroadcastEnable,
                                               &RoutingProtocol::GetBroadcastEnable),
                           MakeBooleanChecker())
+            .AddAttribute("TimerCoalescing",
+                          "Indicates whether the RREQ and RERR rate limit timers of all the "
+                          "nodes share their scheduler events (see ns3::TimerCoalescer). "
+                          "The hello timers are jittered, and are not coalesced.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&RoutingProtocol::m_timerCoalescing),
+                          MakeBooleanChecker())
             .AddAttribute("UniformRv",
                           "Access to the underlying UniformRandomVariable",
                           StringValue("ns3::UniformRandomVariable"),
@@ -397,9 +405,11 @@ RoutingProtocol::Start()
         m_nb.ScheduleTimer();
     }
     m_rreqRateLimitTimer.SetFunction(&RoutingProtocol::RreqRateLimitTimerExpire, this);
+    m_rreqRateLimitTimer.SetCoalescing(m_timerCoalescing);
     m_rreqRateLimitTimer.Schedule(Seconds(1));
 
     m_rerrRateLimitTimer.SetFunction(&RoutingProtocol::RerrRateLimitTimerExpire, this);
+    m_rerrRateLimitTimer.SetCoalescing(m_timerCoalescing);
     m_rerrRateLimitTimer.Schedule(Seconds(1));
 }
 
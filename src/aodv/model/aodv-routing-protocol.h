@@ -249,6 +249,7 @@ class RoutingProtocol : public Ipv4RoutingProtocol
                              ///< originated route discovery.
     bool m_enableHello;      ///< Indicates whether a hello messages enable
     bool m_enableBroadcast;  ///< Indicates whether a a broadcast data packets forwarding enable
+    bool m_timerCoalescing;  ///< Indicates whether the rate limit timers are coalesced
 
     /// IP protocol
     Ptr<Ipv4> m_ipv4;
@@ -27,6 +27,7 @@
 #include "ns3/socket-factory.h"
 #include "ns3/socket.h"
 #include "ns3/string.h"
+#include "ns3/timer-coalescer.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/udp-socket-factory.h"
 #include "ns3/uinteger.h"
@@ -85,6 +86,12 @@ OnOffApplication::GetTypeId()
                           BooleanValue(false),
                           MakeBooleanAccessor(&OnOffApplication::m_enableSeqTsSizeHeader),
                           MakeBooleanChecker())
+            .AddAttribute("TimerCoalescing",
+                          "Whether the send events of the applications expiring at the same "
+                          "time share their scheduler events (see ns3::TimerCoalescer)",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&OnOffApplication::m_timerCoalescing),
+                          MakeBooleanChecker())
             .AddTraceSource("Tx",
                             "A new packet is created and is sent",
                             MakeTraceSourceAccessor(&OnOffApplication::m_txTrace),
@@ -245,7 +252,7 @@ OnOffApplication::CancelEvents()
 {
     NS_LOG_FUNCTION(this);
 
-    if (m_sendEvent.IsPending() && m_cbrRateFailSafe == m_cbrRate)
+    if (TimerCoalescer::IsPending(m_sendEvent) && m_cbrRateFailSafe == m_cbrRate)
     { // Cancel the pending send packet event
         // Calculate residual bits since last packet sent
         Time delta(Simulator::Now() - m_lastStartTime);
@@ -253,7 +260,7 @@ OnOffApplication::CancelEvents()
         m_residualBits += bits.GetHigh();
     }
     m_cbrRateFailSafe = m_cbrRate;
-    Simulator::Cancel(m_sendEvent);
+    TimerCoalescer::Cancel(m_sendEvent);
     Simulator::Cancel(m_startStopEvent);
     // Canceling events may cause discontinuity in sequence number if the
     // SeqTsSizeHeader is header, and m_unsentPacket is true
@@ -299,7 +306,14 @@ OnOffApplication::ScheduleNextTx()
         Time nextTime(
             Seconds(bits / static_cast<double>(m_cbrRate.GetBitRate()))); // Time till next packet
         NS_LOG_LOGIC("nextTime = " << nextTime.As(Time::S));
-        m_sendEvent = Simulator::Schedule(nextTime, &OnOffApplication::SendPacket, this);
+        if (m_timerCoalescing)
+        {
+            m_sendEvent = TimerCoalescer::Schedule(nextTime, &OnOffApplication::SendPacket, this);
+        }
+        else
+        {
+            m_sendEvent = Simulator::Schedule(nextTime, &OnOffApplication::SendPacket, this);
+        }
     }
     else
     { // All done, cancel any pending events
@@ -12,12 +12,14 @@
 #include "seq-ts-header.h"
 
 #include "ns3/address-utils.h"
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/nstime.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include "ns3/socket-factory.h"
 #include "ns3/socket.h"
+#include "ns3/timer-coalescer.h"
 #include "ns3/uinteger.h"
 
 #include <cstdio>
@@ -75,6 +77,12 @@ UdpClient::GetTypeId()
                           UintegerValue(1024),
                           MakeUintegerAccessor(&UdpClient::m_size),
                           MakeUintegerChecker<uint32_t>(12, 65507))
+            .AddAttribute("TimerCoalescing",
+                          "Whether the send events of the clients expiring at the same time "
+                          "share their scheduler events (see ns3::TimerCoalescer)",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&UdpClient::m_timerCoalescing),
+                          MakeBooleanChecker())
             .AddTraceSource("Tx",
                             "A new packet is created and sent",
                             MakeTraceSourceAccessor(&UdpClient::m_txTrace),
@@ -91,7 +99,8 @@ UdpClient::UdpClient()
       m_totalTx{0},
       m_socket{nullptr},
       m_peerPort{},
-      m_sendEvent{}
+      m_sendEvent{},
+      m_timerCoalescing{false}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -235,7 +244,7 @@ void
 UdpClient::StopApplication()
 {
     NS_LOG_FUNCTION(this);
-    Simulator::Cancel(m_sendEvent);
+    TimerCoalescer::Cancel(m_sendEvent);
 }
 
 void
@@ -277,7 +286,14 @@ UdpClient::Send()
 
     if (m_sent < m_count || m_count == 0)
     {
-        m_sendEvent = Simulator::Schedule(m_interval, &UdpClient::Send, this);
+        if (m_timerCoalescing)
+        {
+            m_sendEvent = TimerCoalescer::Schedule(m_interval, &UdpClient::Send, this);
+        }
+        else
+        {
+            m_sendEvent = Simulator::Schedule(m_interval, &UdpClient::Send, this);
+        }
     }
 }
 
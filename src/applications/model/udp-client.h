@@ -104,6 +104,7 @@ class UdpClient : public SourceApplication
     Ptr<Socket> m_socket;               //!< Socket
     std::optional<uint16_t> m_peerPort; //!< Remote peer port (deprecated) // NS_DEPRECATED_3_44
     EventId m_sendEvent;                //!< Event to send the next packet
+    bool m_timerCoalescing;             //!< Whether the send events are coalesced
 
 #ifdef NS3_LOG_ENABLE
     std::string m_peerString; //!< Remote peer address string
@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "replication-runner.h"
+
+#include "ns3/abort.h"
+#include "ns3/config.h"
+#include "ns3/global-value.h"
+#include "ns3/log.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <thread>
+
+#ifndef __WIN32__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file
+ * @ingroup core-helpers
+ * ns3::ReplicationRunner implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ReplicationRunner");
+
+ReplicationRunner::ReplicationRunner()
+    : m_runs(1),
+      m_firstRun(1),
+      m_workers(0),
+      m_failed(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+ReplicationRunner::SetScenario(Scenario scenario)
+{
+    NS_LOG_FUNCTION(this);
+    m_scenario = scenario;
+}
+
+void
+ReplicationRunner::AddParameter(const std::string& name, const std::vector<std::string>& values)
+{
+    NS_LOG_FUNCTION(this << name << values.size());
+    NS_ABORT_MSG_IF(values.empty(), "No value for parameter " << name);
+    m_grid.emplace_back(name, values);
+}
+
+void
+ReplicationRunner::SetRuns(uint32_t runs, uint64_t first)
+{
+    NS_LOG_FUNCTION(this << runs << first);
+    m_runs = runs;
+    m_firstRun = first;
+}
+
+void
+ReplicationRunner::SetMaxWorkers(uint32_t workers)
+{
+    NS_LOG_FUNCTION(this << workers);
+    m_workers = workers;
+}
+
+const ReplicationRunner::Results&
+ReplicationRunner::GetResults() const
+{
+    return m_results;
+}
+
+uint32_t
+ReplicationRunner::GetFailedCount() const
+{
+    return m_failed;
+}
+
+std::vector<ReplicationRunner::Replication>
+ReplicationRunner::GetReplications() const
+{
+    std::vector<Replication> replications;
+    std::vector<std::size_t> index(m_grid.size(), 0);
+    while (true)
+    {
+        for (uint32_t i = 0; i < m_runs; ++i)
+        {
+            Replication replication;
+            for (std::size_t j = 0; j < m_grid.size(); ++j)
+            {
+                const auto& [name, values] = m_grid[j];
+                replication.parameters[name] = values[index[j]];
+                replication.prefix.emplace_back(name, values[index[j]]);
+            }
+            replication.run = m_firstRun + i;
+            replication.prefix.emplace_back("run", std::to_string(replication.run));
+            replications.push_back(replication);
+        }
+        // Next grid point, the last parameter varying the fastest.
+        std::size_t j = m_grid.size();
+        while (j > 0 && ++index[j - 1] == m_grid[j - 1].second.size())
+        {
+            index[j - 1] = 0;
+            --j;
+        }
+        if (j == 0)
+        {
+            break;
+        }
+    }
+    return replications;
+}
+
+ReplicationRunner::Results
+ReplicationRunner::RunReplication(const Replication& replication) const
+{
+    NS_LOG_FUNCTION(this << replication.run);
+    RngSeedManager::SetRun(replication.run);
+    for (const auto& [name, value] : replication.parameters)
+    {
+        if (name.find("::") != std::string::npos)
+        {
+            NS_ABORT_MSG_UNLESS(Config::SetDefaultFailSafe(name, StringValue(value)),
+                                "Cannot set attribute " << name << " to " << value);
+        }
+        else if (std::any_of(GlobalValue::Begin(), GlobalValue::End(), [&name](auto global) {
+                     return global->GetName() == name;
+                 }))
+        {
+            NS_ABORT_MSG_UNLESS(GlobalValue::BindFailSafe(name, StringValue(value)),
+                                "Cannot set global value " << name << " to " << value);
+        }
+        // Otherwise, the parameter is only known by the scenario.
+    }
+    Results results;
+    m_scenario(replication.parameters, results);
+    Simulator::Destroy();
+    return results;
+}
+
+/**
+ * Escape the separators of the results encoding.
+ * @param [in] s The string.
+ * @returns The escaped string.
+ */
+static std::string
+EscapeField(const std::string& s)
+{
+    std::string escaped;
+    for (char c : s)
+    {
+        switch (c)
+        {
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '\t':
+            escaped += "\\t";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        case '=':
+            escaped += "\\e";
+            break;
+        default:
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string
+ReplicationRunner::Encode(const Results& results)
+{
+    // One line per row, with tab-separated name=value cells.
+    std::string data;
+    for (const auto& row : results)
+    {
+        for (std::size_t i = 0; i < row.size(); ++i)
+        {
+            data += (i > 0 ? "\t" : "") + EscapeField(row[i].first) + "=" +
+                    EscapeField(row[i].second);
+        }
+        data += "\n";
+    }
+    return data;
+}
+
+ReplicationRunner::Results
+ReplicationRunner::Decode(const std::string& data)
+{
+    Results results;
+    Row row;
+    std::string field;
+    std::string name;
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        char c = data[i];
+        if (c == '\\' && i + 1 < data.size())
+        {
+            char e = data[++i];
+            field += (e == 't' ? '\t' : e == 'n' ? '\n' : e == 'e' ? '=' : e);
+        }
+        else if (c == '=')
+        {
+            name = field;
+            field.clear();
+        }
+        else if (c == '\n' && row.empty() && name.empty() && field.empty())
+        {
+            results.emplace_back();
+        }
+        else if (c == '\t' || c == '\n')
+        {
+            row.emplace_back(name, field);
+            name.clear();
+            field.clear();
+            if (c == '\n')
+            {
+                results.push_back(row);
+                row.clear();
+            }
+        }
+        else
+        {
+            field += c;
+        }
+    }
+    return results;
+}
+
+void
+ReplicationRunner::Run()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ABORT_MSG_UNLESS(m_scenario, "No scenario to run");
+    std::vector<Replication> replications = GetReplications();
+    std::vector<Results> results(replications.size());
+    m_results.clear();
+    m_failed = 0;
+
+#ifdef __WIN32__
+    for (std::size_t i = 0; i < replications.size(); ++i)
+    {
+        results[i] = RunReplication(replications[i]);
+        Config::Reset();
+    }
+#else
+    // Otherwise, the output buffered so far would be written by every worker.
+    LogBufferFlush();
+    std::cout.flush();
+    std::cerr.flush();
+    std::clog.flush();
+    std::fflush(nullptr);
+
+    /// A worker process.
+    struct Worker
+    {
+        pid_t pid;         //!< The process id.
+        int fd;            //!< The read end of the results pipe.
+        std::size_t index; //!< The index of the replication.
+    };
+
+    const uint32_t maxWorkers =
+        m_workers > 0 ? m_workers : std::max(std::thread::hardware_concurrency(), 1U);
+    std::deque<Worker> running;
+
+    // The oldest worker is collected first.  The others may block until
+    // their results are read, but they do not prevent it from completing.
+    auto collectOldest = [this, &running, &results]() {
+        Worker worker = running.front();
+        running.pop_front();
+        std::string data;
+        char buffer[4096];
+        ssize_t n;
+        while ((n = read(worker.fd, buffer, sizeof(buffer))) != 0)
+        {
+            if (n < 0)
+            {
+                NS_ABORT_MSG_IF(errno != EINTR, "Cannot read results: " << std::strerror(errno));
+                continue;
+            }
+            data.append(buffer, n);
+        }
+        close(worker.fd);
+        int status;
+        while (waitpid(worker.pid, &status, 0) < 0)
+        {
+            NS_ABORT_MSG_IF(errno != EINTR, "Cannot wait for worker: " << std::strerror(errno));
+        }
+        if (WIFEXITED(status) && WEXITSTATUS(status) == 0)
+        {
+            results[worker.index] = Decode(data);
+        }
+        else
+        {
+            NS_LOG_WARN("Replication " << worker.index << " failed with status " << status);
+            m_failed++;
+        }
+    };
+
+    for (std::size_t i = 0; i < replications.size(); ++i)
+    {
+        if (running.size() >= maxWorkers)
+        {
+            collectOldest();
+        }
+        int fds[2];
+        NS_ABORT_MSG_IF(pipe(fds) < 0, "Cannot create a pipe: " << std::strerror(errno));
+        // The messages logged since the last fork.
+        LogBufferFlush();
+        pid_t pid = fork();
+        NS_ABORT_MSG_IF(pid < 0, "Cannot fork a worker: " << std::strerror(errno));
+        if (pid == 0)
+        {
+            close(fds[0]);
+            for (const auto& worker : running)
+            {
+                close(worker.fd);
+            }
+            std::string data = Encode(RunReplication(replications[i]));
+            std::size_t written = 0;
+            while (written < data.size())
+            {
+                ssize_t n = write(fds[1], data.data() + written, data.size() - written);
+                if (n < 0 && errno != EINTR)
+                {
+                    LogBufferFlush();
+                    _exit(1);
+                }
+                written += std::max<ssize_t>(n, 0);
+            }
+            close(fds[1]);
+            LogBufferFlush();
+            std::cout.flush();
+            std::cerr.flush();
+            std::clog.flush();
+            std::fflush(nullptr);
+            // Skip the destructors of the objects of the parent.
+            _exit(0);
+        }
+        NS_LOG_LOGIC("replication " << i << " is process " << pid);
+        close(fds[1]);
+        running.push_back({pid, fds[0], i});
+    }
+    while (!running.empty())
+    {
+        collectOldest();
+    }
+#endif
+
+    for (std::size_t i = 0; i < replications.size(); ++i)
+    {
+        for (const auto& row : results[i])
+        {
+            Row merged = replications[i].prefix;
+            merged.insert(merged.end(), row.begin(), row.end());
+            m_results.push_back(merged);
+        }
+    }
+}
+
+/**
+ * Quote a CSV field if needed.
+ * @param [in] s The field.
+ * @returns The CSV field.
+ */
+static std::string
+QuoteCsv(const std::string& s)
+{
+    if (s.find_first_of(",\"\n") == std::string::npos)
+    {
+        return s;
+    }
+    std::string quoted = "\"";
+    for (char c : s)
+    {
+        quoted += (c == '"') ? std::string("\"\"") : std::string(1, c);
+    }
+    return quoted + "\"";
+}
+
+void
+ReplicationRunner::WriteCsv(std::ostream& os) const
+{
+    std::vector<std::string> columns;
+    for (const auto& row : m_results)
+    {
+        for (const auto& cell : row)
+        {
+            if (std::find(columns.begin(), columns.end(), cell.first) == columns.end())
+            {
+                columns.push_back(cell.first);
+            }
+        }
+    }
+    for (std::size_t i = 0; i < columns.size(); ++i)
+    {
+        os << (i > 0 ? "," : "") << QuoteCsv(columns[i]);
+    }
+    os << "\n";
+    for (const auto& row : m_results)
+    {
+        for (std::size_t i = 0; i < columns.size(); ++i)
+        {
+            auto it = std::find_if(row.begin(), row.end(), [&columns, i](const auto& cell) {
+                return cell.first == columns[i];
+            });
+            os << (i > 0 ? "," : "") << (it != row.end() ? QuoteCsv(it->second) : "");
+        }
+        os << "\n";
+    }
+}
+
+} // namespace ns3
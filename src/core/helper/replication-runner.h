@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef REPLICATION_RUNNER_H
+#define REPLICATION_RUNNER_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core-helpers
+ * ns3::ReplicationRunner declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup core-helpers
+ * @brief Run the independent replications of a parameter sweep
+ * concurrently, in worker processes.
+ *
+ * The sweep is the cartesian product of the values of each parameter
+ * added with AddParameter(), times the RngRun values set by SetRuns().
+ * Each replication runs in its own forked worker process, with at most
+ * one worker per hardware thread unless set otherwise by SetMaxWorkers(),
+ * so the replications cannot interfere through the simulator, the Config
+ * defaults or any other global state.
+ *
+ * In each worker, the runner sets the RngRun, sets the parameters whose
+ * name contains \c "::" with Config::SetDefault() and the parameters
+ * named after a global value with GlobalValue::Bind(), aborting if a value
+ * is invalid, then calls the scenario with all the parameters, including
+ * those only known by the scenario.  The scenario builds the topology, runs the
+ * simulation and adds its results (e.g. FlowMonitor statistics) as rows
+ * of named columns.  The runner calls Simulator::Destroy() after the
+ * scenario, and sends the rows to the parent process, which merges them
+ * in a single table, each row prefixed by the parameters and the run of
+ * its replication.
+ *
+ * @code
+ *   ReplicationRunner runner;
+ *   runner.AddParameter("txPower", {"10", "14", "18"});
+ *   runner.AddParameter("ns3::WifiRemoteStationManager::RtsCtsThreshold", {"0", "65535"});
+ *   runner.SetRuns(5);
+ *   runner.SetScenario([](const ReplicationRunner::Parameters& parameters,
+ *                         ReplicationRunner::Results& results) {
+ *       double txPower = std::stod(parameters.at("txPower"));
+ *       // build and run the scenario
+ *       results.push_back({{"throughput", std::to_string(throughput)}});
+ *   });
+ *   runner.Run();
+ *   runner.WriteCsv(std::cout);
+ * @endcode
+ *
+ * On Windows, the replications run sequentially in the calling process,
+ * and Config::Reset() is called after each of them.
+ */
+class ReplicationRunner
+{
+  public:
+    /** The parameters of a replication, by name. */
+    typedef std::map<std::string, std::string> Parameters;
+    /** A row of results: the column names and values. */
+    typedef std::vector<std::pair<std::string, std::string>> Row;
+    /** The rows of results of a replication. */
+    typedef std::vector<Row> Results;
+    /**
+     * The scenario of a replication.
+     * @param [in] parameters The parameters of the replication.
+     * @param [out] results The results of the replication.
+     */
+    typedef std::function<void(const Parameters& parameters, Results& results)> Scenario;
+
+    /** Constructor. */
+    ReplicationRunner();
+
+    /**
+     * Set the scenario run by each replication.
+     * @param [in] scenario The scenario.
+     */
+    void SetScenario(Scenario scenario);
+
+    /**
+     * Add a dimension to the parameter grid.
+     * @param [in] name The parameter name: an attribute name if it contains
+     *             \c "::", a global value name, or a name only known by the
+     *             scenario.
+     * @param [in] values The values of the parameter.
+     */
+    void AddParameter(const std::string& name, const std::vector<std::string>& values);
+
+    /**
+     * Set the RngRun values of the replications of each grid point.
+     * @param [in] runs The number of replications.
+     * @param [in] first The first RngRun value.
+     */
+    void SetRuns(uint32_t runs, uint64_t first = 1);
+
+    /**
+     * Set the maximum number of concurrent worker processes.
+     * @param [in] workers The number of workers, 0 for one per hardware thread.
+     */
+    void SetMaxWorkers(uint32_t workers);
+
+    /**
+     * Run all the replications and merge their results.
+     */
+    void Run();
+
+    /**
+     * Get the merged results.
+     *
+     * Each row starts with the parameters and the \c run column.
+     *
+     * @returns The results of all the replications, in grid order.
+     */
+    const Results& GetResults() const;
+
+    /**
+     * Get the number of replications which failed.
+     * @returns The number of replications whose worker did not exit normally.
+     */
+    uint32_t GetFailedCount() const;
+
+    /**
+     * Write the merged results as CSV, with the union of all the columns.
+     * @param [in] os The output stream.
+     */
+    void WriteCsv(std::ostream& os) const;
+
+  private:
+    /** A replication: the parameters and the RngRun. */
+    struct Replication
+    {
+        Parameters parameters; //!< The parameters.
+        Row prefix;            //!< The parameters and run, as result columns.
+        uint64_t run;          //!< The RngRun value.
+    };
+
+    /**
+     * Get all the replications of the sweep.
+     * @returns The replications, in grid order.
+     */
+    std::vector<Replication> GetReplications() const;
+
+    /**
+     * Configure the simulator and run the scenario of a replication.
+     * @param [in] replication The replication.
+     * @returns The results of the replication.
+     */
+    Results RunReplication(const Replication& replication) const;
+
+    /**
+     * Encode results for the transfer from a worker.
+     * @param [in] results The results.
+     * @returns The encoded results.
+     */
+    static std::string Encode(const Results& results);
+    /**
+     * Decode results received from a worker.
+     * @param [in] data The encoded results.
+     * @returns The results.
+     */
+    static Results Decode(const std::string& data);
+
+    Scenario m_scenario; //!< The scenario.
+    /** The parameter grid, in insertion order. */
+    std::vector<std::pair<std::string, std::vector<std::string>>> m_grid;
+    uint32_t m_runs;     //!< Number of replications per grid point.
+    uint64_t m_firstRun; //!< First RngRun value.
+    uint32_t m_workers;  //!< Maximum number of workers.
+    Results m_results;   //!< The merged results.
+    uint32_t m_failed;   //!< Number of failed replications.
+};
+
+} // namespace ns3
+
+#endif /* REPLICATION_RUNNER_H */
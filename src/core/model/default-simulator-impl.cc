@@ -9,10 +9,12 @@
 #include "default-simulator-impl.h"
 
 #include "assert.h"
+#include "boolean.h"
 #include "log.h"
 #include "scheduler.h"
 #include "simulator.h"
 
+#include <algorithm>
 #include <cmath>
 
 /**
@@ -37,7 +39,15 @@ DefaultSimulatorImpl::GetTypeId()
     static TypeId tid = TypeId("ns3::DefaultSimulatorImpl")
                             .SetParent<SimulatorImpl>()
                             .SetGroupName("Core")
-                            .AddConstructor<DefaultSimulatorImpl>();
+                            .AddConstructor<DefaultSimulatorImpl>()
+                            .AddAttribute("MeasureInjectionLatency",
+                                          "Measure the wall-clock delay of the events scheduled "
+                                          "from foreign threads, at the cost of reading the "
+                                          "clock on every such event.",
+                                          BooleanValue(false),
+                                          MakeBooleanAccessor(
+                                              &DefaultSimulatorImpl::m_measureInjectionLatency),
+                                          MakeBooleanChecker());
     return tid;
 }
 
@@ -51,7 +61,11 @@ DefaultSimulatorImpl::DefaultSimulatorImpl()
     m_currentContext = Simulator::NO_CONTEXT;
     m_unscheduledEvents = 0;
     m_eventCount = 0;
-    m_eventsWithContextEmpty = true;
+    m_eventsWithContext = nullptr;
+    m_measureInjectionLatency = false;
+    m_injectedEvents = 0;
+    m_injectionLatencyTotal = 0;
+    m_injectionLatencyMax = 0;
     m_mainThreadId = std::this_thread::get_id();
 }
 
@@ -130,7 +144,7 @@ DefaultSimulatorImpl::ProcessOneEvent()
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    InvokeEvent(next.impl, next.key.m_context);
     next.impl->Unref();
 
     ProcessEventsWithContext();
@@ -145,30 +159,52 @@ DefaultSimulatorImpl::IsFinished() const
 void
 DefaultSimulatorImpl::ProcessEventsWithContext()
 {
-    if (m_eventsWithContextEmpty)
+    if (m_eventsWithContext.load(std::memory_order_relaxed) == nullptr)
     {
         return;
     }
 
-    // swap queues
-    EventsWithContext eventsWithContext;
+    // take the whole stack, and reverse it to get the events in the
+    // order they were scheduled
+    EventWithContext* stack = m_eventsWithContext.exchange(nullptr, std::memory_order_acquire);
+    EventWithContext* batch = nullptr;
+    while (stack != nullptr)
     {
-        std::unique_lock lock{m_eventsWithContextMutex};
-        m_eventsWithContext.swap(eventsWithContext);
-        m_eventsWithContextEmpty = true;
+        EventWithContext* next = stack->next;
+        stack->next = batch;
+        batch = stack;
+        stack = next;
     }
-    while (!eventsWithContext.empty())
+
+    std::chrono::steady_clock::time_point now;
+    if (m_measureInjectionLatency)
+    {
+        now = std::chrono::steady_clock::now();
+    }
+    while (batch != nullptr)
     {
-        EventWithContext event = eventsWithContext.front();
-        eventsWithContext.pop_front();
+        EventWithContext* event = batch;
+        batch = batch->next;
         Scheduler::Event ev;
-        ev.impl = event.event;
-        ev.key.m_ts = m_currentTs + event.timestamp;
-        ev.key.m_context = event.context;
+        ev.impl = event->event;
+        ev.key.m_ts = m_currentTs + event->timestamp;
+        ev.key.m_context = event->context;
         ev.key.m_uid = m_uid;
         m_uid++;
         m_unscheduledEvents++;
         m_events->Insert(ev);
+
+        m_injectedEvents++;
+        if (m_measureInjectionLatency)
+        {
+            // Events pushed before the measure was enabled have no timestamp.
+            auto injected = event->injected.time_since_epoch().count() != 0 ? event->injected : now;
+            uint64_t latency =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(now - injected).count();
+            m_injectionLatencyTotal += latency;
+            m_injectionLatencyMax = std::max(m_injectionLatencyMax, latency);
+        }
+        delete event;
     }
 }
 
@@ -248,15 +284,21 @@ DefaultSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay, E
     }
     else
     {
-        EventWithContext ev;
-        ev.context = context;
+        auto ev = new EventWithContext;
+        ev->context = context;
         // Current time added in ProcessEventsWithContext()
-        ev.timestamp = delay.GetTimeStep();
-        ev.event = event;
+        ev->timestamp = delay.GetTimeStep();
+        ev->event = event;
+        if (m_measureInjectionLatency)
+        {
+            ev->injected = std::chrono::steady_clock::now();
+        }
+        ev->next = m_eventsWithContext.load(std::memory_order_relaxed);
+        while (!m_eventsWithContext.compare_exchange_weak(ev->next,
+                                                          ev,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed))
         {
-            std::unique_lock lock{m_eventsWithContextMutex};
-            m_eventsWithContext.push_back(ev);
-            m_eventsWithContextEmpty = false;
         }
     }
 }
@@ -386,4 +428,43 @@ DefaultSimulatorImpl::GetEventCount() const
     return m_eventCount;
 }
 
+bool
+DefaultSimulatorImpl::CanInvokeWithContext() const
+{
+    return true;
+}
+
+void
+DefaultSimulatorImpl::InvokeWithContext(uint32_t context, EventImpl* event)
+{
+    PreEventHook(EventId(Ptr<EventImpl>(event), m_currentTs, context, m_currentUid));
+    uint32_t currentContext = m_currentContext;
+    m_currentContext = context;
+    m_eventCount++;
+    InvokeEvent(event, context);
+    m_currentContext = currentContext;
+}
+
+uint64_t
+DefaultSimulatorImpl::GetInjectedEventCount() const
+{
+    return m_injectedEvents;
+}
+
+Time
+DefaultSimulatorImpl::GetMeanInjectionLatency() const
+{
+    if (m_injectedEvents == 0)
+    {
+        return Time(0);
+    }
+    return NanoSeconds(m_injectionLatencyTotal / m_injectedEvents);
+}
+
+Time
+DefaultSimulatorImpl::GetMaxInjectionLatency() const
+{
+    return NanoSeconds(m_injectionLatencyMax);
+}
+
 } // namespace ns3
@@ -9,10 +9,12 @@
 #ifndef DEFAULT_SIMULATOR_IMPL_H
 #define DEFAULT_SIMULATOR_IMPL_H
 
+#include "event-impl.h"
 #include "simulator-impl.h"
 
+#include <atomic>
+#include <chrono>
 #include <list>
-#include <mutex>
 #include <thread>
 
 /**
@@ -66,6 +68,37 @@ class DefaultSimulatorImpl : public SimulatorImpl
     uint32_t GetSystemId() const override;
     uint32_t GetContext() const override;
     uint64_t GetEventCount() const override;
+    bool CanInvokeWithContext() const override;
+    void InvokeWithContext(uint32_t context, EventImpl* event) override;
+
+    /**
+     * Get the number of events scheduled from a foreign thread
+     * with ScheduleWithContext() and moved to the event queue.
+     * @return The number of injected events.
+     */
+    uint64_t GetInjectedEventCount() const;
+    /**
+     * Get the average wall-clock delay between the call to
+     * ScheduleWithContext() from a foreign thread and the insertion
+     * of the event in the event queue.
+     *
+     * The latency is only measured if the \c MeasureInjectionLatency
+     * attribute is \c true.
+     *
+     * @return The mean injection latency.
+     */
+    Time GetMeanInjectionLatency() const;
+    /**
+     * Get the largest wall-clock delay between the call to
+     * ScheduleWithContext() from a foreign thread and the insertion
+     * of the event in the event queue.
+     *
+     * The latency is only measured if the \c MeasureInjectionLatency
+     * attribute is \c true.
+     *
+     * @return The maximum injection latency.
+     */
+    Time GetMaxInjectionLatency() const;
 
   private:
     void DoDispose() override;
@@ -75,7 +108,12 @@ class DefaultSimulatorImpl : public SimulatorImpl
     /** Move events from a different context into the main event queue. */
     void ProcessEventsWithContext();
 
-    /** Wrap an event with its execution context. */
+    /**
+     * Wrap an event with its execution context.
+     *
+     * The wrappers are allocated from the pool of EventImpl, which
+     * recycles the blocks released by the main thread.
+     */
     struct EventWithContext
     {
         /** The event context. */
@@ -84,19 +122,50 @@ class DefaultSimulatorImpl : public SimulatorImpl
         uint64_t timestamp;
         /** The event implementation. */
         EventImpl* event;
+        /**
+         * Wall-clock time of the call to ScheduleWithContext(), only
+         * recorded if the injection latency is measured.
+         */
+        std::chrono::steady_clock::time_point injected;
+        /** The previously pushed event. */
+        EventWithContext* next;
+
+        /**
+         * Allocate a wrapper from the event pool.
+         * @param [in] size The size of the wrapper.
+         * @returns The storage.
+         */
+        static void* operator new(std::size_t size)
+        {
+            return EventImpl::operator new(size);
+        }
+
+        /**
+         * Release a wrapper to the event pool.
+         * @param [in] p The storage.
+         * @param [in] size The size of the wrapper.
+         */
+        static void operator delete(void* p, std::size_t size)
+        {
+            EventImpl::operator delete(p, size);
+        }
     };
 
-    /** Container type for the events from a different context. */
-    typedef std::list<EventWithContext> EventsWithContext;
-    /** The container of events from a different context. */
-    EventsWithContext m_eventsWithContext;
     /**
-     * Flag \c true if all events with context have been moved to the
-     * primary event queue.
+     * The events from a different thread, as a lock-free stack:
+     * foreign threads push with a compare-and-swap, the main
+     * thread takes the whole stack at once and reverses it.
      */
-    bool m_eventsWithContextEmpty;
-    /** Mutex to control access to the list of events with context. */
-    std::mutex m_eventsWithContextMutex;
+    std::atomic<EventWithContext*> m_eventsWithContext;
+    /** Whether the injection latency is measured. */
+    bool m_measureInjectionLatency;
+
+    /** Number of events moved from m_eventsWithContext. */
+    uint64_t m_injectedEvents;
+    /** Sum of the injection latencies, in nanoseconds. */
+    uint64_t m_injectionLatencyTotal;
+    /** Largest injection latency, in nanoseconds. */
+    uint64_t m_injectionLatencyMax;
 
     /** Container type for the events to run at Simulator::Destroy() */
     typedef std::list<EventId> DestroyEvents;
@@ -10,6 +10,11 @@
 
 #include "log.h"
 
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
 /**
  * @file
  * @ingroup events
@@ -21,6 +26,286 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("EventImpl");
 
+namespace
+{
+
+/** Granularity of the pool size classes, in bytes. */
+constexpr std::size_t POOL_GRANULARITY = 16;
+/** Number of size classes, the larger events are allocated directly. */
+constexpr std::size_t POOL_CLASSES = 16;
+/** Size of the chunks obtained from the system allocator, in bytes. */
+constexpr std::size_t POOL_CHUNK_SIZE = 64 * 1024;
+
+/** A free block of a size class, linked in a free list. */
+struct FreeBlock
+{
+    FreeBlock* next; //!< The next free block.
+};
+
+/** A list of free blocks of a size class. */
+struct FreeList
+{
+    FreeBlock* head{nullptr}; //!< The first block.
+    std::size_t count{0};     //!< The number of blocks.
+};
+
+/**
+ * Get the number of blocks in a chunk, which is also the number of
+ * blocks moved at once between a thread and the depot.
+ * @param [in] sizeClass The size class.
+ * @returns The number of blocks.
+ */
+constexpr std::size_t
+BlocksPerChunk(std::size_t sizeClass)
+{
+    return POOL_CHUNK_SIZE / ((sizeClass + 1) * POOL_GRANULARITY);
+}
+
+/** Free blocks shared by all the threads. */
+struct PoolDepot
+{
+    std::mutex mutex;                            //!< Protects the batches and chunks.
+    std::vector<FreeList> batches[POOL_CLASSES]; //!< Batches of free blocks, per class.
+    std::vector<char*> chunks[POOL_CLASSES];     //!< Chunks obtained from the system, per class.
+    std::atomic<std::size_t> reserved{0};        //!< Bytes obtained from the system.
+};
+
+/**
+ * Whether the chunks of the pool have been returned to the system.
+ * The events are then allocated by the system allocator.
+ */
+std::atomic<bool> g_poolDestroyed{false};
+
+/**
+ * Get the depot.
+ *
+ * The depot is created on demand and never destroyed, since events may be
+ * released during the destruction of static objects; the PoolDestructor
+ * only frees its chunks.
+ *
+ * @returns The depot.
+ */
+PoolDepot&
+GetDepot()
+{
+    static auto depot = new PoolDepot;
+    return *depot;
+}
+
+/**
+ * Free blocks of the current thread.
+ *
+ * This is trivially destructible, so it remains usable until the end of the
+ * thread, after the PoolCacheGuard has moved its blocks to the depot.
+ */
+thread_local FreeList t_cache[POOL_CLASSES];
+/** Whether the current thread is exiting. */
+thread_local bool t_exited = false;
+
+/** Returns the free blocks of an exiting thread to the depot. */
+struct PoolCacheGuard
+{
+    ~PoolCacheGuard()
+    {
+        PoolDepot& depot = GetDepot();
+        std::lock_guard lock(depot.mutex);
+        for (std::size_t i = 0; i < POOL_CLASSES; ++i)
+        {
+            if (t_cache[i].count > 0)
+            {
+                depot.batches[i].push_back(t_cache[i]);
+                t_cache[i] = FreeList();
+            }
+        }
+        t_exited = true;
+    }
+};
+
+/** Registers the current thread for the return of its free blocks. */
+thread_local PoolCacheGuard t_guard;
+
+/**
+ * Fill the free list of the current thread, from the depot or from a new
+ * chunk.
+ * @param [in] sizeClass The size class.
+ */
+void
+Refill(std::size_t sizeClass)
+{
+    PoolDepot& depot = GetDepot();
+    {
+        std::lock_guard lock(depot.mutex);
+        auto& batches = depot.batches[sizeClass];
+        if (!batches.empty())
+        {
+            t_cache[sizeClass] = batches.back();
+            batches.pop_back();
+            return;
+        }
+    }
+    const std::size_t blockSize = (sizeClass + 1) * POOL_GRANULARITY;
+    const std::size_t count = BlocksPerChunk(sizeClass);
+    auto chunk = static_cast<char*>(::operator new(POOL_CHUNK_SIZE));
+    depot.reserved += POOL_CHUNK_SIZE;
+    {
+        std::lock_guard lock(depot.mutex);
+        depot.chunks[sizeClass].push_back(chunk);
+    }
+    FreeBlock* head = nullptr;
+    for (std::size_t i = count; i > 0; --i)
+    {
+        auto block = reinterpret_cast<FreeBlock*>(chunk + (i - 1) * blockSize);
+        block->next = head;
+        head = block;
+    }
+    t_cache[sizeClass] = {head, count};
+}
+
+/**
+ * Move one batch of free blocks of the current thread to the depot.
+ * @param [in] sizeClass The size class.
+ */
+void
+Flush(std::size_t sizeClass)
+{
+    FreeList& list = t_cache[sizeClass];
+    FreeList batch{list.head, BlocksPerChunk(sizeClass)};
+    FreeBlock* last = list.head;
+    for (std::size_t i = 1; i < batch.count; ++i)
+    {
+        last = last->next;
+    }
+    list.head = last->next;
+    list.count -= batch.count;
+    last->next = nullptr;
+
+    PoolDepot& depot = GetDepot();
+    std::lock_guard lock(depot.mutex);
+    depot.batches[sizeClass].push_back(batch);
+}
+
+/**
+ * Returns the chunks of the pool to the system at the end of the program,
+ * so that memory checkers don't report them as leaked.
+ *
+ * The chunks are only freed if all their blocks are free, i.e., if no
+ * event outlives this object; otherwise they remain reachable from the
+ * depot.  This runs after the destruction of the thread_local objects of
+ * the main thread, so the other threads are expected to have exited and
+ * returned their free blocks to the depot.
+ */
+struct PoolDestructor
+{
+    ~PoolDestructor()
+    {
+        PoolDepot& depot = GetDepot();
+        std::lock_guard lock(depot.mutex);
+        std::size_t freeBlocks = 0;
+        std::size_t reservedBlocks = 0;
+        for (std::size_t i = 0; i < POOL_CLASSES; ++i)
+        {
+            // The blocks of the current thread, if it didn't allocate any event.
+            freeBlocks += t_cache[i].count;
+            for (const auto& batch : depot.batches[i])
+            {
+                freeBlocks += batch.count;
+            }
+            reservedBlocks += depot.chunks[i].size() * BlocksPerChunk(i);
+        }
+        if (freeBlocks != reservedBlocks)
+        {
+            NS_LOG_LOGIC("Events outlive the pool, its chunks are not freed");
+            return;
+        }
+        for (std::size_t i = 0; i < POOL_CLASSES; ++i)
+        {
+            for (auto chunk : depot.chunks[i])
+            {
+                ::operator delete(chunk);
+            }
+            depot.chunks[i].clear();
+            depot.batches[i].clear();
+            t_cache[i] = FreeList();
+        }
+        depot.reserved = 0;
+        g_poolDestroyed = true;
+    }
+};
+
+/** Frees the chunks of the pool at the end of the program. */
+PoolDestructor g_poolDestructor;
+
+} // namespace
+
+void*
+EventImpl::operator new(std::size_t size)
+{
+    const std::size_t sizeClass = (size - 1) / POOL_GRANULARITY;
+    if (sizeClass >= POOL_CLASSES || g_poolDestroyed.load(std::memory_order_relaxed))
+    {
+        return ::operator new(size);
+    }
+    if (t_cache[sizeClass].count == 0)
+    {
+        // Make sure the free blocks go back to the depot when the thread exits.
+        [[maybe_unused]] const auto guard = &t_guard;
+        Refill(sizeClass);
+    }
+    FreeList& list = t_cache[sizeClass];
+    FreeBlock* block = list.head;
+    list.head = block->next;
+    list.count--;
+    return block;
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t size)
+{
+    const std::size_t sizeClass = (size - 1) / POOL_GRANULARITY;
+    if (sizeClass >= POOL_CLASSES || g_poolDestroyed.load(std::memory_order_relaxed))
+    {
+        ::operator delete(p);
+        return;
+    }
+    auto block = static_cast<FreeBlock*>(p);
+    if (t_exited)
+    {
+        PoolDepot& depot = GetDepot();
+        std::lock_guard lock(depot.mutex);
+        block->next = nullptr;
+        depot.batches[sizeClass].push_back({block, 1});
+        return;
+    }
+    FreeList& list = t_cache[sizeClass];
+    block->next = list.head;
+    list.head = block;
+    list.count++;
+    if (list.count >= 2 * BlocksPerChunk(sizeClass))
+    {
+        // Threads which release more events than they allocate, such as the
+        // consumer of events scheduled by other threads, give them back.
+        Flush(sizeClass);
+    }
+}
+
+void*
+EventImpl::operator new(std::size_t size, std::align_val_t alignment)
+{
+    return ::operator new(size, alignment);
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t /* size */, std::align_val_t alignment)
+{
+    ::operator delete(p, alignment);
+}
+
+std::size_t
+EventImpl::GetPoolReservedBytes()
+{
+    return GetDepot().reserved;
+}
+
 EventImpl::~EventImpl()
 {
     NS_LOG_FUNCTION(this);
@@ -56,4 +341,10 @@ EventImpl::IsCancelled()
     return m_cancel;
 }
 
+EventImpl::Callee
+EventImpl::GetCallee() const
+{
+    return {&typeid(*this), {0, 0}, nullptr};
+}
+
 } // namespace ns3
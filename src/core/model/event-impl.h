@@ -10,7 +10,14 @@
 
 #include "simple-ref-count.h"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <new>
 #include <stdint.h>
+#include <type_traits>
+#include <typeinfo>
 
 /**
  * @file
@@ -30,6 +37,15 @@ namespace ns3
  * when it reaches the time associated to this event. Most subclasses
  * are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * The storage of the events is recycled by a pool of per-thread free
+ * lists, one per size class of 16 bytes, up to 256 bytes.  Events are
+ * allocated and released at a very high rate, so this avoids a call to
+ * the system allocator for most events.  Blocks released by another
+ * thread than the allocating one are simply recycled by the releasing
+ * thread, and the excess blocks of a thread are returned to a shared
+ * depot.  The memory of the pool is returned to the system at the end
+ * of the program, if no event outlives it.
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
@@ -56,7 +72,76 @@ class EventImpl : public SimpleRefCount<EventImpl>
      */
     bool IsCancelled();
 
+    /**
+     * The function called by an event, which identifies the events in the
+     * EventProfiler.
+     *
+     * Functions and methods of the same type are told apart by the value
+     * of their pointer; functors, such as lambdas, by their type alone.
+     */
+    struct Callee
+    {
+        const std::type_info* type;     //!< The type of the function pointer or functor.
+        std::array<uintptr_t, 2> value; //!< The pointer value, zero for functors.
+        const void* address;            //!< The code address, if known.
+    };
+
+    /**
+     * Get the function called by this event.
+     *
+     * The default implementation returns the type of the event itself.
+     *
+     * @returns The callee.
+     */
+    virtual Callee GetCallee() const;
+
+    /**
+     * Allocate the storage of an event from the pool.
+     * @param [in] size The size of the event.
+     * @returns The storage.
+     */
+    static void* operator new(std::size_t size);
+    /**
+     * Release the storage of an event to the pool.
+     * @param [in] p The storage.
+     * @param [in] size The size of the event.
+     */
+    static void operator delete(void* p, std::size_t size);
+    /**
+     * Allocate the storage of an over-aligned event from the system allocator,
+     * since the blocks of the pool are only aligned for \c std::max_align_t.
+     * @param [in] size The size of the event.
+     * @param [in] alignment The alignment of the event.
+     * @returns The storage.
+     */
+    static void* operator new(std::size_t size, std::align_val_t alignment);
+    /**
+     * Release the storage of an over-aligned event.
+     * @param [in] p The storage.
+     * @param [in] size The size of the event.
+     * @param [in] alignment The alignment of the event.
+     */
+    static void operator delete(void* p, std::size_t size, std::align_val_t alignment);
+    /**
+     * Get the memory reserved by the event pool.
+     *
+     * This only grows when the number of live events exceeds the number
+     * of events ever released.
+     *
+     * @returns The number of bytes obtained from the system allocator.
+     */
+    static std::size_t GetPoolReservedBytes();
+
   protected:
+    /**
+     * Get the Callee of a function pointer, method pointer or functor.
+     * @tparam F \deduced The type of the function.
+     * @param [in] function The function.
+     * @returns The callee.
+     */
+    template <typename F>
+    static Callee MakeCallee(const F& function);
+
     /**
      * Implementation for Invoke().
      *
@@ -69,6 +154,39 @@ class EventImpl : public SimpleRefCount<EventImpl>
     bool m_cancel; /**< Has this event been cancelled. */
 };
 
+template <typename F>
+EventImpl::Callee
+EventImpl::MakeCallee(const F& function)
+{
+    Callee callee{&typeid(F), {0, 0}, nullptr};
+    if constexpr (std::is_pointer_v<F> || std::is_member_function_pointer_v<F>)
+    {
+        std::memcpy(callee.value.data(), &function, std::min(sizeof(F), sizeof(callee.value)));
+    }
+    if constexpr (std::is_pointer_v<F>)
+    {
+        callee.address = reinterpret_cast<const void*>(callee.value[0]);
+    }
+#ifdef __GXX_ABI_VERSION
+    else if constexpr (std::is_member_function_pointer_v<F>)
+    {
+        // Itanium C++ ABI: the first word is the address of the method, or
+        // the offset of a virtual method in the vtable, tagged in its lowest
+        // bit, or in the lowest bit of the second word on ARM.
+#if defined(__arm__) || defined(__aarch64__)
+        bool isVirtual = callee.value[1] & 1;
+#else
+        bool isVirtual = callee.value[0] & 1;
+#endif
+        if (!isVirtual)
+        {
+            callee.address = reinterpret_cast<const void*>(callee.value[0]);
+        }
+    }
+#endif
+    return callee;
+}
+
 } // namespace ns3
 
 #endif /* EVENT_IMPL_H */
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "event-profiler.h"
+
+#include "demangle.h"
+#include "event-impl.h"
+#include "fatal-error.h"
+#include "log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <tuple>
+
+#ifndef __WIN32__
+#include <dlfcn.h>
+#endif
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::EventProfiler implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("EventProfiler");
+
+namespace
+{
+
+/** Source of the profiler ids. */
+std::atomic<uint64_t> g_nextProfilerId{1};
+
+/**
+ * Escape a string for a quoted CSV or JSON field.
+ * @param [in] s The string.
+ * @param [in] quote The escape sequence of a double quote.
+ * @returns The escaped string.
+ */
+std::string
+Escape(const std::string& s, const std::string& quote)
+{
+    std::string escaped;
+    for (char c : s)
+    {
+        if (c == '"')
+        {
+            escaped += quote;
+        }
+        else if (c == '\\' && quote == "\\\"")
+        {
+            escaped += "\\\\";
+        }
+        else
+        {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/**
+ * Get the name of a callee.
+ * @param [in] type The callee type.
+ * @param [in] value The callee pointer value.
+ * @param [in] address The callee address, if known.
+ * @returns The symbol at the callee address, if found, and otherwise its
+ *          demangled type, followed by its pointer value unless it is a functor.
+ */
+std::string
+GetCalleeName(const std::type_info& type,
+              const std::array<uintptr_t, 2>& value,
+              const void* address)
+{
+#ifndef __WIN32__
+    Dl_info info;
+    if (address && dladdr(address, &info) != 0 && info.dli_sname && info.dli_saddr == address)
+    {
+        return Demangle(info.dli_sname);
+    }
+#endif
+    std::string name = Demangle(type.name());
+    if (value[0] == 0 && value[1] == 0)
+    {
+        return name;
+    }
+    std::ostringstream oss;
+    oss << name << (address ? " at 0x" : " virtual 0x") << std::hex << value[0];
+    return oss.str();
+}
+
+} // namespace
+
+EventProfiler::EventProfiler()
+    : m_id(g_nextProfilerId++)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+EventProfiler::~EventProfiler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+EventProfiler::Table&
+EventProfiler::GetTable()
+{
+    /// The profiler id and the table of the last profiler used by this thread.
+    thread_local std::pair<uint64_t, Table*> t_table{0, nullptr};
+    if (t_table.first != m_id)
+    {
+        std::lock_guard lock(m_mutex);
+        m_tables.push_back(std::make_unique<Table>());
+        t_table = {m_id, m_tables.back().get()};
+    }
+    return *t_table.second;
+}
+
+void
+EventProfiler::Invoke(EventImpl* event, uint32_t context)
+{
+    /// The time spent by this thread in the events nested in the current one.
+    thread_local uint64_t t_nestedNs = 0;
+
+    uint64_t outerNestedNs = t_nestedNs;
+    t_nestedNs = 0;
+    auto start = std::chrono::steady_clock::now();
+    event->Invoke();
+    auto end = std::chrono::steady_clock::now();
+    uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    uint64_t ns = elapsed - std::min(elapsed, t_nestedNs);
+    t_nestedNs = outerNestedNs + elapsed;
+
+    EventImpl::Callee callee = event->GetCallee();
+    Cost& cost = GetTable()[Key{*callee.type, callee.value, context}];
+    cost.type = callee.type;
+    cost.address = callee.address;
+    cost.count++;
+    cost.totalNs += ns;
+    cost.maxNs = std::max(cost.maxNs, ns);
+}
+
+std::vector<EventProfiler::Entry>
+EventProfiler::GetHistogram() const
+{
+    NS_LOG_FUNCTION(this);
+    Table merged;
+    for (const auto& table : m_tables)
+    {
+        for (const auto& [key, cost] : *table)
+        {
+            Cost& total = merged[key];
+            total.type = cost.type;
+            total.address = cost.address;
+            total.count += cost.count;
+            total.totalNs += cost.totalNs;
+            total.maxNs = std::max(total.maxNs, cost.maxNs);
+        }
+    }
+
+    std::vector<Entry> histogram;
+    histogram.reserve(merged.size());
+    for (const auto& [key, cost] : merged)
+    {
+        histogram.push_back({GetCalleeName(*cost.type, key.value, cost.address),
+                             key.context,
+                             cost.count,
+                             cost.totalNs,
+                             cost.maxNs});
+    }
+    std::sort(histogram.begin(), histogram.end(), [](const Entry& a, const Entry& b) {
+        return std::tie(b.totalNs, a.callee, a.context) < std::tie(a.totalNs, b.callee, b.context);
+    });
+    return histogram;
+}
+
+void
+EventProfiler::WriteCsv(std::ostream& os) const
+{
+    os << "callee,context,count,total_ns,mean_ns,max_ns\n";
+    for (const auto& entry : GetHistogram())
+    {
+        os << '"' << Escape(entry.callee, "\"\"") << "\"," << entry.context << ','
+           << entry.count << ',' << entry.totalNs << ',' << entry.totalNs / entry.count << ','
+           << entry.maxNs << '\n';
+    }
+}
+
+void
+EventProfiler::WriteJson(std::ostream& os) const
+{
+    os << "{\n \"events\" : [";
+    char separator = ' ';
+    for (const auto& entry : GetHistogram())
+    {
+        os << separator << "\n  {\"callee\" : \"" << Escape(entry.callee, "\\\"")
+           << "\", \"context\" : " << entry.context << ", \"count\" : " << entry.count
+           << ", \"total_ns\" : " << entry.totalNs
+           << ", \"mean_ns\" : " << entry.totalNs / entry.count
+           << ", \"max_ns\" : " << entry.maxNs << "}";
+        separator = ',';
+    }
+    os << "\n ]\n}\n";
+}
+
+void
+EventProfiler::Write(const std::string& filename) const
+{
+    NS_LOG_FUNCTION(this << filename);
+    std::ofstream os(filename);
+    if (!os.is_open())
+    {
+        NS_FATAL_ERROR("Cannot open event profile file " << filename);
+    }
+    const std::string json = ".json";
+    if (filename.size() >= json.size() &&
+        filename.compare(filename.size() - json.size(), json.size(), json) == 0)
+    {
+        WriteJson(os);
+    }
+    else
+    {
+        WriteCsv(os);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+#include "event-impl.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::EventProfiler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup simulator
+ * @brief Attribute the wall-clock time spent in the events to their callee
+ * and context.
+ *
+ * DesMetrics records the causality of the events (which context scheduled
+ * which event, and when); the EventProfiler records what they cost.  Each
+ * event is identified by its callee, as returned by EventImpl::GetCallee():
+ * the function or class method it calls, or the type of its functor.  In
+ * the histogram, functions and methods are named by the symbol found at
+ * their address, if any, and otherwise by their type and address, or, for
+ * virtual methods, their type and pointer value.  Lambdas are named by
+ * their type, which names the function defining the lambda.  Symbols are
+ * only found for functions exported by a shared library or, with the
+ * \c -rdynamic linker option, by the executable.
+ *
+ * The profiler is enabled by setting the \c EventProfile attribute of the
+ * SimulatorImpl to the name of the output file:
+ * @code
+ *   Config::SetDefault("ns3::SimulatorImpl::EventProfile", StringValue("profile.csv"));
+ * @endcode
+ * or, from the command line of a script using CommandLine,
+ * @verbatim
+   --ns3::SimulatorImpl::EventProfile=profile.csv \endverbatim
+ * The histogram is written when the simulator is destroyed, sorted by
+ * decreasing total cost, in JSON if the file name ends with \c .json, and
+ * in CSV otherwise, with the columns
+ * @verbatim
+   callee,context,count,total_ns,mean_ns,max_ns \endverbatim
+ * Events without context have the context \c 4294967295 (Simulator::NO_CONTEXT).
+ *
+ * The cost of an event excludes that of the events it invokes itself, as
+ * with SimulatorImpl::InvokeWithContext(), which are recorded on their own.
+ *
+ * Events can be recorded concurrently by several threads, each of them
+ * recording in its own table.  When the profiler is disabled, the
+ * simulator only tests a null pointer per event.
+ */
+class EventProfiler
+{
+  public:
+    /** The cost of the events of a callee in a context. */
+    struct Entry
+    {
+        std::string callee; //!< The name of the callee.
+        uint32_t context;   //!< The context.
+        uint64_t count;     //!< The number of events.
+        uint64_t totalNs;   //!< The total wall-clock time, in nanoseconds.
+        uint64_t maxNs;     //!< The maximum wall-clock time, in nanoseconds.
+    };
+
+    /** Constructor. */
+    EventProfiler();
+    /** Destructor. */
+    ~EventProfiler();
+
+    /**
+     * Invoke an event and record its cost.
+     *
+     * This can be called from the invoked event, in which case the cost of
+     * the nested event is subtracted from that of the outer one.
+     *
+     * @param [in] event The event.
+     * @param [in] context The context of the event.
+     */
+    void Invoke(EventImpl* event, uint32_t context);
+
+    /**
+     * Get the histogram, sorted by decreasing total cost.
+     *
+     * This must not be called while events are recorded.
+     *
+     * @returns The histogram entries.
+     */
+    std::vector<Entry> GetHistogram() const;
+
+    /**
+     * Write the histogram as CSV.
+     * @param [in] os The output stream.
+     */
+    void WriteCsv(std::ostream& os) const;
+    /**
+     * Write the histogram as JSON.
+     * @param [in] os The output stream.
+     */
+    void WriteJson(std::ostream& os) const;
+    /**
+     * Write the histogram to a file, in JSON if its name ends with \c .json
+     * and in CSV otherwise.
+     * @param [in] filename The name of the file.
+     */
+    void Write(const std::string& filename) const;
+
+  private:
+    /** Key of the tables: the callee type and pointer value, and the context. */
+    struct Key
+    {
+        std::type_index type;           //!< The callee type.
+        std::array<uintptr_t, 2> value; //!< The callee pointer value.
+        uint32_t context;               //!< The context.
+
+        /**
+         * @param [in] other The other key.
+         * @returns \c true if the keys are equal.
+         */
+        bool operator==(const Key& other) const
+        {
+            return std::tie(type, value, context) ==
+                   std::tie(other.type, other.value, other.context);
+        }
+    };
+
+    /** Hash of the table keys. */
+    struct KeyHash
+    {
+        /**
+         * @param [in] key The key.
+         * @returns The hash of the key.
+         */
+        std::size_t operator()(const Key& key) const
+        {
+            std::size_t hash = key.type.hash_code();
+            for (auto word : {key.value[0], key.value[1], uintptr_t{key.context}})
+            {
+                hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+            }
+            return hash;
+        }
+    };
+
+    /** The cost of the events of a key. */
+    struct Cost
+    {
+        const std::type_info* type{nullptr}; //!< The callee type.
+        const void* address{nullptr};        //!< The callee address, if known.
+        uint64_t count{0};                   //!< The number of events.
+        uint64_t totalNs{0};                 //!< The total wall-clock time, in nanoseconds.
+        uint64_t maxNs{0};                   //!< The maximum wall-clock time, in nanoseconds.
+    };
+
+    /** The costs recorded by one thread. */
+    typedef std::unordered_map<Key, Cost, KeyHash> Table;
+
+    /**
+     * Get the table of the current thread.
+     * @returns The table.
+     */
+    Table& GetTable();
+
+    uint64_t m_id;                                //!< Unique id of this profiler.
+    std::mutex m_mutex;                           //!< Protects m_tables.
+    std::vector<std::unique_ptr<Table>> m_tables; //!< The tables of all the threads.
+};
+
+} // namespace ns3
+
+#endif /* EVENT_PROFILER_H */
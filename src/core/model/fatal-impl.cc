@@ -176,6 +176,9 @@ void
 FlushStreams()
 {
     NS_LOG_FUNCTION_NOARGS();
+    // Do not lose the messages recorded before the error.
+    LogBufferFlush();
+
     std::list<std::ostream*>** pl = PeekStreamList();
     if (*pl == nullptr)
     {
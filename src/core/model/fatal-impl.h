@@ -68,7 +68,8 @@ void UnregisterStream(std::ostream* stream);
  *
  * @brief Flush all currently registered streams.
  *
- * This function iterates through each registered stream and
+ * This function first flushes the log buffer of the calling thread
+ * (see LogBufferFlush()), then iterates through each registered stream and
  * unregisters them. The default \c SIGSEGV handler is overridden
  * when this function is being executed, and will be restored
  * when this function returns.
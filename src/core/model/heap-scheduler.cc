@@ -225,6 +225,12 @@ HeapScheduler::Remove(const Event& ev)
             NS_ASSERT(m_heap[i].impl == ev.impl);
             Exch(i, Last());
             m_heap.pop_back();
+            // The event moved into the hole may be smaller than its new parent
+            while (i <= Last() && !IsRoot(i) && IsLessStrictly(i, Parent(i)))
+            {
+                Exch(i, Parent(i));
+                i = Parent(i);
+            }
             TopDown(i);
             return;
         }
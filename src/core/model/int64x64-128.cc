@@ -189,41 +189,6 @@ int64x64_t::Udiv(const uint128_t a, const uint128_t b)
     return result;
 }
 
-void
-int64x64_t::MulByInvert(const int64x64_t& o)
-{
-    bool negResult = _v < 0;
-    uint128_t a = negResult ? -static_cast<uint128_t>(_v) : _v;
-    uint128_t result = UmulByInvert(a, o._v);
-
-    _v = negResult ? -result : result;
-}
-
-uint128_t
-int64x64_t::UmulByInvert(const uint128_t a, const uint128_t b)
-{
-    // Since b is assumed to be the output of Invert(), b <= 2^127.
-    NS_ASSERT(b <= HP128_MASK_HI_BIT);
-
-    uint128_t al = a & HP_MASK_LO;
-    uint128_t bl = b & HP_MASK_LO;
-    uint128_t ah = a >> 64;
-    uint128_t bh = b >> 64;
-
-    // Since ah, bh <= 2^63, high <= 2^126 and there is no overflow.
-    uint128_t high = ah * bh;
-
-    // Since ah, bh <= 2^63 and al, bl < 2^64, mid < 2^128 and there is
-    // no overflow.
-    uint128_t mid = ah * bl + al * bh;
-    mid >>= 64;
-
-    // Since high <= 2^126 and mid < 2^64, result < 2^127 and there is no overflow.
-    uint128_t result = high + mid;
-
-    return result;
-}
-
 int64x64_t
 int64x64_t::Invert(const uint64_t v)
 {
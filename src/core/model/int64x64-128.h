@@ -17,6 +17,7 @@
 
 #include <cmath> // pow
 #include <stdint.h>
+#include <utility> // swap
 
 #if defined(HAVE___UINT128_T) && !defined(HAVE_UINT128_T)
 /**
@@ -288,7 +289,13 @@ class int64x64_t
      *
      * @see Invert()
      */
-    void MulByInvert(const int64x64_t& o);
+    inline void MulByInvert(const int64x64_t& o)
+    {
+        const bool negResult = _v < 0;
+        const uint128_t a = negResult ? -static_cast<uint128_t>(_v) : _v;
+        const uint128_t result = UmulByInvert(a, o._v);
+        _v = negResult ? -result : result;
+    }
 
     /**
      * Compute the inverse of an integer value.
@@ -347,13 +354,19 @@ class int64x64_t
 
     friend inline int64x64_t& operator*=(int64x64_t& lhs, const int64x64_t& rhs)
     {
-        lhs.Mul(rhs);
+        if (!lhs.MulByInteger(rhs))
+        {
+            lhs.Mul(rhs);
+        }
         return lhs;
     }
 
     friend inline int64x64_t& operator/=(int64x64_t& lhs, const int64x64_t& rhs)
     {
-        lhs.Div(rhs);
+        if (!lhs.DivByInteger(rhs))
+        {
+            lhs.Div(rhs);
+        }
         return lhs;
     }
 
@@ -401,6 +414,62 @@ class int64x64_t
      * @param [in] o The divisor.
      */
     void Div(const int64x64_t& o);
+    /**
+     * Fast path of Mul(), when one of the factors is an integer.
+     *
+     * Scaling a Time, or converting it to a larger unit, multiplies by an
+     * integer: the product is then a single native 128-bit multiplication,
+     * equal to the one computed by Mul().
+     *
+     * @param [in] o The other factor.
+     * @return \c false, leaving this value unchanged, if neither factor is
+     *         an integer or if the product overflows.
+     */
+    inline bool MulByInteger(const int64x64_t& o)
+    {
+        uint128_t a = _v < 0 ? -static_cast<uint128_t>(_v) : _v;
+        uint128_t b = o._v < 0 ? -static_cast<uint128_t>(o._v) : o._v;
+        if (b & HP_MASK_LO)
+        {
+            if (a & HP_MASK_LO)
+            {
+                return false;
+            }
+            std::swap(a, b);
+        }
+        uint128_t result;
+        if (__builtin_mul_overflow(a, b >> 64, &result) || (result & HP128_MASK_HI_BIT))
+        {
+            // Let Mul() report the overflow.
+            return false;
+        }
+        _v = ((_v < 0) != (o._v < 0)) ? -result : result;
+        return true;
+    }
+
+    /**
+     * Fast path of Div(), when the divisor is an integer.
+     *
+     * The quotient is then a single native 128-bit division, equal to the
+     * one computed bit by bit by Udiv().  This is the case of the ratio of
+     * two Times.
+     *
+     * @param [in] o The divisor.
+     * @return \c false, leaving this value unchanged, if the divisor is
+     *         not a non-zero integer.
+     */
+    inline bool DivByInteger(const int64x64_t& o)
+    {
+        if ((o._v & HP_MASK_LO) || o._v == 0)
+        {
+            return false;
+        }
+        const uint128_t a = _v < 0 ? -static_cast<uint128_t>(_v) : _v;
+        const uint128_t b = o._v < 0 ? -static_cast<uint128_t>(o._v) : o._v;
+        const uint128_t result = a / (b >> 64);
+        _v = ((_v < 0) != (o._v < 0)) ? -result : result;
+        return true;
+    }
     /**
      * Unsigned multiplication of Q64.64 values.
      *
@@ -443,7 +512,25 @@ class int64x64_t
      *
      * @see Invert()
      */
-    static uint128_t UmulByInvert(const uint128_t a, const uint128_t b);
+    static inline uint128_t UmulByInvert(const uint128_t a, const uint128_t b)
+    {
+        // Since b is the output of Invert(), b <= 2^127.
+        const uint128_t al = a & HP_MASK_LO;
+        const uint128_t bl = b & HP_MASK_LO;
+        const uint128_t ah = a >> 64;
+        const uint128_t bh = b >> 64;
+
+        // Since ah, bh <= 2^63, high <= 2^126 and there is no overflow.
+        const uint128_t high = ah * bh;
+
+        // Since ah, bh <= 2^63 and al, bl < 2^64, mid < 2^128 and there is
+        // no overflow.
+        uint128_t mid = ah * bl + al * bh;
+        mid >>= 64;
+
+        // Since high <= 2^126 and mid < 2^64, result < 2^127 and there is no overflow.
+        return high + mid;
+    }
 
     int128_t _v; //!< The Q64.64 value.
 };
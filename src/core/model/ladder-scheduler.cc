@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ladder-scheduler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+#include "uinteger.h"
+
+#include <algorithm>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * ns3::LadderScheduler class implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LadderScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(LadderScheduler);
+
+TypeId
+LadderScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::LadderScheduler")
+            .SetParent<Scheduler>()
+            .SetGroupName("Core")
+            .AddConstructor<LadderScheduler>()
+            .AddAttribute("MaxRungs",
+                          "The maximum number of rungs of the ladder",
+                          UintegerValue(8),
+                          MakeUintegerAccessor(&LadderScheduler::m_maxRungs),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("BucketThreshold",
+                          "Number of events in a bucket above which it is split in a new rung",
+                          UintegerValue(50),
+                          MakeUintegerAccessor(&LadderScheduler::m_threshold),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+LadderScheduler::LadderScheduler()
+{
+    NS_LOG_FUNCTION(this);
+    m_topMin = 0;
+    m_topMax = 0;
+    m_topStart = 0;
+    m_bottomHead = 0;
+    m_bottomHeap = false;
+    m_qSize = 0;
+}
+
+LadderScheduler::~LadderScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+/** Ordering of the Bottom heap: the next event is at the front. */
+static bool
+Later(const Scheduler::Event& a, const Scheduler::Event& b)
+{
+    return a.key > b.key;
+}
+
+uint64_t
+LadderScheduler::CurrentStart(const Rung& rung)
+{
+    return rung.start + rung.current * rung.width;
+}
+
+std::size_t
+LadderScheduler::FindRung(uint64_t ts) const
+{
+    for (std::size_t i = 0; i < m_rungs.size(); ++i)
+    {
+        if (ts >= CurrentStart(m_rungs[i]))
+        {
+            return i;
+        }
+    }
+    return m_rungs.size();
+}
+
+void
+LadderScheduler::AddRung(uint64_t start, uint64_t span, std::size_t count)
+{
+    NS_LOG_FUNCTION(this << start << span << count);
+    NS_ASSERT(span > 0);
+    // One bucket per event on average, but never less than one time
+    // unit per bucket.
+    uint64_t nBuckets = std::max<uint64_t>(1, std::min<uint64_t>(count, span));
+    Rung rung;
+    rung.width = (span + nBuckets - 1) / nBuckets;
+    rung.buckets.resize(nBuckets);
+    rung.start = start;
+    rung.current = 0;
+    rung.count = 0;
+    m_rungs.push_back(std::move(rung));
+}
+
+void
+LadderScheduler::InsertInRung(Rung& rung, const Scheduler::Event& ev)
+{
+    std::size_t index = (ev.key.m_ts - rung.start) / rung.width;
+    NS_ASSERT(index >= rung.current && index < rung.buckets.size());
+    rung.buckets[index].push_back(ev);
+    rung.count++;
+}
+
+bool
+LadderScheduler::IsBottomEmpty() const
+{
+    return m_bottomHead == m_bottom.size();
+}
+
+void
+LadderScheduler::InsertInBottom(const Scheduler::Event& ev)
+{
+    if (m_bottomHeap)
+    {
+        m_bottom.push_back(ev);
+        std::push_heap(m_bottom.begin(), m_bottom.end(), Later);
+        return;
+    }
+    if (IsBottomEmpty() || !(ev.key < m_bottom.back().key))
+    {
+        // The uids increase, so the events of a burst on the same
+        // timestamp are appended in FIFO order.
+        m_bottom.push_back(ev);
+        return;
+    }
+    if (m_bottom.size() - m_bottomHead < m_threshold)
+    {
+        m_bottom.insert(std::upper_bound(m_bottom.begin() + m_bottomHead, m_bottom.end(), ev), ev);
+        return;
+    }
+
+    // Bottom is too large for ordered inserts.
+    m_bottom.erase(m_bottom.begin(), m_bottom.begin() + m_bottomHead);
+    m_bottomHead = 0;
+    uint64_t start = std::min(ev.key.m_ts, m_bottom.front().key.m_ts);
+    uint64_t end = m_rungs.empty() ? m_topStart : CurrentStart(m_rungs.back());
+    if (m_rungs.size() < m_maxRungs && start != m_bottom.back().key.m_ts)
+    {
+        // Spread it on a new rung covering everything up to the current
+        // bucket of the finest rung.
+        Bucket events;
+        events.swap(m_bottom);
+        events.push_back(ev);
+        AddRung(start, end - start, events.size());
+        for (const auto& event : events)
+        {
+            InsertInRung(m_rungs.back(), event);
+        }
+        return;
+    }
+    // Its events are on a single timestamp, or no rung is left: it
+    // becomes a heap until it is empty.
+    NS_LOG_LOGIC("bottom of " << m_bottom.size() << " events becomes a heap");
+    m_bottom.push_back(ev);
+    std::make_heap(m_bottom.begin(), m_bottom.end(), Later);
+    m_bottomHeap = true;
+}
+
+void
+LadderScheduler::Insert(const Scheduler::Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    uint64_t ts = ev.key.m_ts;
+    m_qSize++;
+
+    if (ts >= m_topStart)
+    {
+        if (m_top.empty())
+        {
+            m_topMin = ts;
+            m_topMax = ts;
+        }
+        else
+        {
+            m_topMin = std::min(m_topMin, ts);
+            m_topMax = std::max(m_topMax, ts);
+        }
+        m_top.push_back(ev);
+        return;
+    }
+
+    std::size_t i = FindRung(ts);
+    if (i < m_rungs.size())
+    {
+        InsertInRung(m_rungs[i], ev);
+    }
+    else
+    {
+        InsertInBottom(ev);
+    }
+}
+
+bool
+LadderScheduler::IsEmpty() const
+{
+    return m_qSize == 0;
+}
+
+void
+LadderScheduler::Refill()
+{
+    if (!IsBottomEmpty())
+    {
+        return;
+    }
+    m_bottom.clear();
+    m_bottomHead = 0;
+    m_bottomHeap = false;
+    while (m_bottom.empty())
+    {
+        if (m_rungs.empty())
+        {
+            if (m_top.empty())
+            {
+                return;
+            }
+            NS_LOG_LOGIC("transfer " << m_top.size() << " events from top");
+            AddRung(m_topMin, m_topMax - m_topMin + 1, m_top.size());
+            Rung& rung = m_rungs.back();
+            m_topStart = rung.start + rung.buckets.size() * rung.width;
+            for (const auto& event : m_top)
+            {
+                InsertInRung(rung, event);
+            }
+            m_top.clear();
+            continue;
+        }
+
+        Rung& rung = m_rungs.back();
+        if (rung.count == 0)
+        {
+            m_rungs.pop_back();
+            continue;
+        }
+        while (rung.buckets[rung.current].empty())
+        {
+            rung.current++;
+        }
+        Bucket& bucket = rung.buckets[rung.current];
+        if (bucket.size() > m_threshold && m_rungs.size() < m_maxRungs && rung.width > 1)
+        {
+            NS_LOG_LOGIC("split bucket of " << bucket.size() << " events");
+            Bucket events;
+            events.swap(bucket);
+            rung.count -= events.size();
+            uint64_t start = CurrentStart(rung);
+            uint64_t width = rung.width;
+            rung.current++;
+            // rung is invalidated by AddRung
+            AddRung(start, width, events.size());
+            for (const auto& event : events)
+            {
+                InsertInRung(m_rungs.back(), event);
+            }
+            continue;
+        }
+        m_bottom.swap(bucket);
+        rung.count -= m_bottom.size();
+        rung.current++;
+        std::sort(m_bottom.begin(), m_bottom.end());
+    }
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    // Moving events down the ladder does not change the content of the queue.
+    const_cast<LadderScheduler*>(this)->Refill();
+    return m_bottomHeap ? m_bottom.front() : m_bottom[m_bottomHead];
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    Refill();
+    Scheduler::Event ev;
+    if (m_bottomHeap)
+    {
+        std::pop_heap(m_bottom.begin(), m_bottom.end(), Later);
+        ev = m_bottom.back();
+        m_bottom.pop_back();
+    }
+    else
+    {
+        ev = m_bottom[m_bottomHead++];
+        if (m_bottomHead > m_threshold && m_bottomHead > m_bottom.size() / 2)
+        {
+            // Drop the removed events, in case events keep being appended.
+            m_bottom.erase(m_bottom.begin(), m_bottom.begin() + m_bottomHead);
+            m_bottomHead = 0;
+        }
+    }
+    m_qSize--;
+    NS_LOG_DEBUG("remove " << ev.impl << ", time " << ev.key.m_ts << ", uid " << ev.key.m_uid);
+    return ev;
+}
+
+void
+LadderScheduler::Remove(const Scheduler::Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    NS_ASSERT(!IsEmpty());
+    uint64_t ts = ev.key.m_ts;
+    Bucket* bucket;
+    if (ts >= m_topStart)
+    {
+        bucket = &m_top;
+    }
+    else
+    {
+        std::size_t i = FindRung(ts);
+        if (i < m_rungs.size())
+        {
+            Rung& rung = m_rungs[i];
+            bucket = &rung.buckets[(ts - rung.start) / rung.width];
+            rung.count--;
+        }
+        else if (m_bottomHeap)
+        {
+            auto it = std::find(m_bottom.begin(), m_bottom.end(), ev);
+            NS_ASSERT(it != m_bottom.end());
+            m_bottom.erase(it);
+            std::make_heap(m_bottom.begin(), m_bottom.end(), Later);
+            m_qSize--;
+            return;
+        }
+        else
+        {
+            auto it = std::lower_bound(m_bottom.begin() + m_bottomHead, m_bottom.end(), ev);
+            NS_ASSERT(it != m_bottom.end() && it->key == ev.key);
+            m_bottom.erase(it);
+            m_qSize--;
+            return;
+        }
+    }
+    auto it = std::find(bucket->begin(), bucket->end(), ev);
+    NS_ASSERT(it != bucket->end());
+    // Top and the rung buckets are not sorted
+    *it = bucket->back();
+    bucket->pop_back();
+    m_qSize--;
+}
+
+} // namespace ns3
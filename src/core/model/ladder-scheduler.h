@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * ns3::LadderScheduler class declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup scheduler
+ * @brief a ladder queue event scheduler
+ *
+ * This event scheduler implements the ladder queue described in
+ * ["Ladder Queue: An O(1) Priority Queue Structure for Large-Scale
+ * Discrete Event Simulation" by Tang, Goh and Thng][Tang], a multi-tier
+ * calendar queue which sizes its buckets from the events it actually
+ * holds instead of resizing a single calendar.
+ *
+ * [Tang]: https://doi.org/10.1145/1103323.1103324 "Tang"
+ *
+ * The queue has three tiers:
+ *  - *Top*, an unsorted `std::vector` of the far future events, with a
+ *    timestamp above the end of the first rung.
+ *  - The *rungs*, up to \c MaxRungs arrays of unsorted buckets.  The
+ *    first rung is built from Top, with one bucket per event on average;
+ *    a bucket holding more than \c BucketThreshold events is split into a
+ *    finer rung covering only that bucket.
+ *  - *Bottom*, a short sorted `std::vector` of the nearest events, filled
+ *    from the first non-empty bucket of the finest rung.
+ *
+ * Events are only sorted once they reach Bottom, so bursts of events
+ * clustered in time only refine the rung covering them, while events far
+ * in the future stay untouched in Top.  This avoids the resize thrashing
+ * of the CalendarScheduler when the event timestamps are skewed.
+ *
+ * The events inserted in Bottom after all of its events, such as a burst
+ * of events on the same timestamp, which have increasing uids, are
+ * appended.  The other ones are inserted in order while Bottom holds less
+ * than \c BucketThreshold events.  Beyond that, Bottom is spread on a new
+ * rung, or, if its events share a single timestamp or no rung is left,
+ * turned into a binary heap until it is empty.
+ *
+ * @par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | ~Constant       | Append to Top, bucket or Bottom; bounded ordered insert in Bottom
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | ~Constant       | Refill Bottom from the rungs
+ * Remove()     | Linear          | Search within Top, bucket or Bottom
+ * RemoveNext() | ~Constant       | Refill Bottom from the rungs
+ *
+ * Insert() and RemoveNext() are logarithmic while Bottom is a heap.
+ *
+ * @par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | 3 x `sizeof (*)` per bucket      | `std::vector`
+ * Per Event | 0                                | Events stored in `std::vector` directly
+ */
+class LadderScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    LadderScheduler();
+    /** Destructor. */
+    ~LadderScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+
+  private:
+    /** Bucket type: an unsorted vector of Events. */
+    typedef std::vector<Scheduler::Event> Bucket;
+
+    /** A rung of the ladder: an array of buckets of identical width. */
+    struct Rung
+    {
+        /** The buckets. */
+        std::vector<Bucket> buckets;
+        /** Timestamp of the start of the first bucket. */
+        uint64_t start;
+        /** Duration of a bucket, in dimensionless time units. */
+        uint64_t width;
+        /** Index of the first bucket which may still hold events. */
+        std::size_t current;
+        /** Number of events in the rung. */
+        std::size_t count;
+    };
+
+    /**
+     * Get the start timestamp of the current bucket of a rung.
+     * @param [in] rung The rung.
+     * @returns The start of the current bucket.
+     */
+    static uint64_t CurrentStart(const Rung& rung);
+    /**
+     * Find the rung in which an event belongs.
+     * @param [in] ts The event timestamp, lower than the start of Top.
+     * @returns The rung index, or the number of rungs for Bottom.
+     */
+    std::size_t FindRung(uint64_t ts) const;
+    /**
+     * Add a rung covering a time range.
+     * @param [in] start The start of the range.
+     * @param [in] span The length of the range.
+     * @param [in] count The expected number of events in the range.
+     */
+    void AddRung(uint64_t start, uint64_t span, std::size_t count);
+    /**
+     * Insert an event in a rung.
+     * @param [in] rung The rung.
+     * @param [in] ev The event.
+     */
+    void InsertInRung(Rung& rung, const Scheduler::Event& ev);
+    /**
+     * Check if Bottom holds no event.
+     * @returns \c true if Bottom is empty.
+     */
+    bool IsBottomEmpty() const;
+    /**
+     * Insert an event in Bottom, keeping it sorted, or in its heap.
+     * @param [in] ev The event.
+     */
+    void InsertInBottom(const Scheduler::Event& ev);
+    /** Move the next events to Bottom, if it is empty. */
+    void Refill();
+
+    /** Top: unsorted events after the end of the first rung. */
+    Bucket m_top;
+    /** Minimum timestamp in Top. */
+    uint64_t m_topMin;
+    /** Maximum timestamp in Top. */
+    uint64_t m_topMax;
+    /** Events with a timestamp greater or equal to this go to Top. */
+    uint64_t m_topStart;
+    /** The rungs, from the coarsest to the finest. */
+    std::vector<Rung> m_rungs;
+    /**
+     * Bottom: the nearest events, sorted in increasing order from
+     * m_bottomHead, or a heap if m_bottomHeap.
+     */
+    Bucket m_bottom;
+    /** Index of the next event in Bottom, when it is sorted. */
+    std::size_t m_bottomHead;
+    /** Whether Bottom is a heap, with the next event at the front. */
+    bool m_bottomHeap;
+    /** Number of events in queue. */
+    uint32_t m_qSize;
+
+    /** Maximum number of rungs. */
+    uint32_t m_maxRungs;
+    /** Bucket size above which a bucket is split into a new rung. */
+    uint32_t m_threshold;
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
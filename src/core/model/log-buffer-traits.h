@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef LOG_BUFFER_TRAITS_H
+#define LOG_BUFFER_TRAITS_H
+
+#include <ostream>
+#include <type_traits>
+
+/**
+ * @file
+ * @ingroup logging
+ * Declaration of the ns3::LogBufferTraits template.
+ *
+ * This is separate from log.h so that the headers of the types which
+ * specialize it, such as nstime.h, don't have to include log.h.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup logging
+ * How a log argument of type \p T is stored in the log buffer.
+ *
+ * Arguments of trivially copyable types with a const output operator are
+ * stored as they are, and formatted when the buffer is flushed.  Those of
+ * other types are formatted when they are logged, unless a specialization
+ * of this template stores a trivially copyable representation of them, as
+ * the one for ns3::Time does.
+ *
+ * Since the deferred arguments are formatted when the buffer is flushed,
+ * an output operator which reads some global state, such as the Time
+ * resolution, sees its value at the flush, not at the logging statement.
+ *
+ * @tparam T \deduced The argument type.
+ */
+template <typename T>
+struct LogBufferTraits
+{
+    /** Whether the formatting of the argument is deferred to the flush. */
+    static constexpr bool deferred =
+        std::is_trivially_copyable_v<T> && requires(std::ostream& os, const T& value) {
+            os << value;
+        };
+    /** The stored representation. */
+    using Stored = T;
+
+    /**
+     * Get the stored representation of an argument.
+     * @param [in] value The argument.
+     * @returns The stored representation.
+     */
+    static Stored Store(const T& value)
+    {
+        return value;
+    }
+
+    /**
+     * Format a stored argument.
+     * @param [in,out] os The output stream.
+     * @param [in] value The stored representation.
+     */
+    static void Print(std::ostream& os, const Stored& value)
+    {
+        os << value;
+    }
+};
+
+} // namespace ns3
+
+#endif /* LOG_BUFFER_TRAITS_H */
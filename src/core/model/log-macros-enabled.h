@@ -148,6 +148,26 @@
 #define NS_LOG_CONDITION
 #endif
 
+#ifndef NS_LOG_STATIC_LEVEL
+/**
+ * @ingroup logging
+ * The log levels compiled in a file.
+ *
+ * The NS_LOG macros of the other levels are compiled out, so they cost
+ * nothing, whatever the levels enabled at run time.
+ *
+ * By default, all the levels are compiled in.  The \c NS3_LOG_LEVEL
+ * CMake option sets this threshold for the whole build, e.g.
+ * \c -DNS3_LOG_LEVEL=warn, and a file can set its own threshold
+ * after its includes:
+ * @code
+ *   #undef NS_LOG_STATIC_LEVEL
+ *   #define NS_LOG_STATIC_LEVEL ns3::LOG_LEVEL_ALL
+ * @endcode
+ */
+#define NS_LOG_STATIC_LEVEL ns3::LOG_LEVEL_ALL
+#endif
+
 /**
  * @ingroup logging
  *
@@ -162,6 +182,9 @@
  * NS_LOG (LOG_DEBUG, "a number="<<aNumber<<", anotherNumber="<<anotherNumber);
  * @endcode
  *
+ * The message is not logged if \c level is not in NS_LOG_STATIC_LEVEL,
+ * and it is recorded in the log buffer if LogBufferIsActive().
+ *
  * @param [in] level The log level
  * @param [in] msg The message to log
  * @internal
@@ -171,16 +194,23 @@
     NS_LOG_CONDITION                                                                               \
     do                                                                                             \
     {                                                                                              \
-        if (g_log.IsEnabled(level))                                                                \
+        if (((level) & NS_LOG_STATIC_LEVEL) && g_log.IsEnabled(level))                             \
         {                                                                                          \
-            NS_LOG_APPEND_TIME_PREFIX;                                                             \
-            NS_LOG_APPEND_NODE_PREFIX;                                                             \
-            NS_LOG_APPEND_CONTEXT;                                                                 \
-            NS_LOG_APPEND_FUNC_PREFIX;                                                             \
-            NS_LOG_APPEND_LEVEL_PREFIX(level);                                                     \
-            auto flags = std::clog.setf(std::ios_base::boolalpha);                                 \
-            std::clog << msg << std::endl;                                                         \
-            std::clog.flags(flags);                                                                \
+            if (ns3::LogBufferIsActive())                                                          \
+            {                                                                                      \
+                ns3::LogRecorder(g_log, level, __FUNCTION__) << msg;                               \
+            }                                                                                      \
+            else                                                                                   \
+            {                                                                                      \
+                NS_LOG_APPEND_TIME_PREFIX;                                                         \
+                NS_LOG_APPEND_NODE_PREFIX;                                                         \
+                NS_LOG_APPEND_CONTEXT;                                                             \
+                NS_LOG_APPEND_FUNC_PREFIX;                                                         \
+                NS_LOG_APPEND_LEVEL_PREFIX(level);                                                 \
+                auto flags = std::clog.setf(std::ios_base::boolalpha);                             \
+                std::clog << msg << std::endl;                                                     \
+                std::clog.flags(flags);                                                            \
+            }                                                                                      \
         }                                                                                          \
     } while (false)
 
@@ -196,12 +226,19 @@
     NS_LOG_CONDITION                                                                               \
     do                                                                                             \
     {                                                                                              \
-        if (g_log.IsEnabled(ns3::LOG_FUNCTION))                                                    \
+        if ((ns3::LOG_FUNCTION & NS_LOG_STATIC_LEVEL) && g_log.IsEnabled(ns3::LOG_FUNCTION))       \
         {                                                                                          \
-            NS_LOG_APPEND_TIME_PREFIX;                                                             \
-            NS_LOG_APPEND_NODE_PREFIX;                                                             \
-            NS_LOG_APPEND_CONTEXT;                                                                 \
-            std::clog << g_log.Name() << ":" << __FUNCTION__ << "()" << std::endl;                 \
+            if (ns3::LogBufferIsActive())                                                          \
+            {                                                                                      \
+                ns3::LogRecorder(g_log, ns3::LOG_FUNCTION, __FUNCTION__, true);                    \
+            }                                                                                      \
+            else                                                                                   \
+            {                                                                                      \
+                NS_LOG_APPEND_TIME_PREFIX;                                                         \
+                NS_LOG_APPEND_NODE_PREFIX;                                                         \
+                NS_LOG_APPEND_CONTEXT;                                                             \
+                std::clog << g_log.Name() << ":" << __FUNCTION__ << "()" << std::endl;             \
+            }                                                                                      \
         }                                                                                          \
     } while (false)
 
@@ -230,16 +267,23 @@
     NS_LOG_CONDITION                                                                               \
     do                                                                                             \
     {                                                                                              \
-        if (g_log.IsEnabled(ns3::LOG_FUNCTION))                                                    \
+        if ((ns3::LOG_FUNCTION & NS_LOG_STATIC_LEVEL) && g_log.IsEnabled(ns3::LOG_FUNCTION))       \
         {                                                                                          \
-            NS_LOG_APPEND_TIME_PREFIX;                                                             \
-            NS_LOG_APPEND_NODE_PREFIX;                                                             \
-            NS_LOG_APPEND_CONTEXT;                                                                 \
-            std::clog << g_log.Name() << ":" << __FUNCTION__ << "(";                               \
-            auto flags = std::clog.setf(std::ios_base::boolalpha);                                 \
-            ns3::ParameterLogger(std::clog) << parameters;                                         \
-            std::clog.flags(flags);                                                                \
-            std::clog << ")" << std::endl;                                                         \
+            if (ns3::LogBufferIsActive())                                                          \
+            {                                                                                      \
+                ns3::LogRecorder(g_log, ns3::LOG_FUNCTION, __FUNCTION__, true) << parameters;      \
+            }                                                                                      \
+            else                                                                                   \
+            {                                                                                      \
+                NS_LOG_APPEND_TIME_PREFIX;                                                         \
+                NS_LOG_APPEND_NODE_PREFIX;                                                         \
+                NS_LOG_APPEND_CONTEXT;                                                             \
+                std::clog << g_log.Name() << ":" << __FUNCTION__ << "(";                           \
+                auto flags = std::clog.setf(std::ios_base::boolalpha);                             \
+                ns3::ParameterLogger(std::clog) << parameters;                                     \
+                std::clog.flags(flags);                                                            \
+                std::clog << ")" << std::endl;                                                     \
+            }                                                                                      \
         }                                                                                          \
     } while (false)
 
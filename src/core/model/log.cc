@@ -10,16 +10,21 @@
 #include "assert.h"
 #include "environment-variable.h"
 #include "fatal-error.h"
+#include "nstime.h"
+#include "simulator.h"
 #include "string.h"
 
 #include "ns3/core-config.h"
 
 #include <algorithm> // transform
-#include <cstring>   // strlen
+#include <atomic>
+#include <cstring> // strlen
 #include <iostream>
+#include <limits>
 #include <list>
 #include <locale> // toupper
 #include <map>
+#include <memory>
 #include <numeric> // accumulate
 #include <stdexcept>
 #include <utility>
@@ -520,4 +525,493 @@ ParameterLogger::CommaRest()
     }
 }
 
+/**
+ * @ingroup logging
+ * Whether the log messages are recorded in the log buffers.
+ * This is private to the logging implementation.
+ */
+static std::atomic<bool> g_logBufferEnabled{false};
+/**
+ * @ingroup logging
+ * The initial size of the log buffers.
+ * This is private to the logging implementation.
+ */
+static std::atomic<uint32_t> g_logBufferSize{1 << 20};
+/**
+ * @ingroup logging
+ * Whether the log buffer of the thread has been destroyed.
+ * This is private to the logging implementation.
+ */
+static thread_local bool t_logBufferDestroyed = false;
+
+/**
+ * @ingroup logging
+ * The log buffer of a thread.
+ *
+ * The buffer holds complete records, followed by the record being
+ * recorded, if any.  Each record is a Record header followed by its
+ * arguments, each of them an Argument header followed by the stored
+ * argument.  All of them are aligned on the maximum alignment.
+ *
+ * This is private to the logging implementation.
+ */
+class LogBuffer
+{
+  public:
+    /** A record header. */
+    struct Record
+    {
+        const LogComponent* component; //!< The log component.
+        const char* function;          //!< The logging function.
+        uint32_t size;                 //!< The size of the record, with its arguments.
+        uint32_t level;                //!< The log level.
+        bool parameters;               //!< Whether this is a NS_LOG_FUNCTION record.
+        bool prefixFunc;               //!< Whether LOG_PREFIX_FUNC is enabled.
+        bool prefixLevel;              //!< Whether LOG_PREFIX_LEVEL is enabled.
+        uint8_t prefixes;              //!< Number of leading time and node prefix arguments.
+    };
+
+    /** An argument header. */
+    struct Argument
+    {
+        LogRecorder::Formatter formatter; //!< The formatter of the argument.
+        uint32_t size;                    //!< The size of the argument, with its header.
+    };
+
+    /** Destructor, flushes the buffer. */
+    ~LogBuffer()
+    {
+        Flush();
+        t_logBufferDestroyed = true;
+    }
+
+    /**
+     * Check if a record can be started.
+     * @returns \c true if no record is being recorded or formatted.
+     */
+    bool IsIdle() const
+    {
+        return m_record == NONE && !m_flushing;
+    }
+
+    /**
+     * Start a record.
+     * @param [in] component The log component.
+     * @param [in] level The log level.
+     * @param [in] function The logging function.
+     * @param [in] parameters Whether this is a NS_LOG_FUNCTION record.
+     */
+    void Begin(const LogComponent* component, uint32_t level, const char* function, bool parameters)
+    {
+        Reserve(Align(sizeof(Record)));
+        m_record = m_used;
+        m_used += Align(sizeof(Record));
+        Record* record = GetRecord();
+        record->component = component;
+        record->function = function;
+        record->level = level;
+        record->parameters = parameters;
+        record->prefixFunc = component->IsEnabled(LOG_PREFIX_FUNC);
+        record->prefixLevel = component->IsEnabled(LOG_PREFIX_LEVEL);
+        record->prefixes = 0;
+    }
+
+    /**
+     * Get the record being recorded.
+     * @returns The record, valid until the next allocation.
+     */
+    Record* GetRecord()
+    {
+        return reinterpret_cast<Record*>(GetData() + m_record);
+    }
+
+    /**
+     * Allocate an argument in the record.
+     * @param [in] size The size of the stored argument.
+     * @param [in] formatter The formatter of the argument.
+     * @returns The storage of the argument, valid until the next allocation.
+     */
+    char* Allocate(std::size_t size, LogRecorder::Formatter formatter)
+    {
+        std::size_t total = Align(sizeof(Argument)) + Align(size);
+        Reserve(total);
+        char* argument = GetData() + m_used;
+        m_used += total;
+        reinterpret_cast<Argument*>(argument)->formatter = formatter;
+        reinterpret_cast<Argument*>(argument)->size = total;
+        return argument + Align(sizeof(Argument));
+    }
+
+    /** Complete the record. */
+    void End()
+    {
+        GetRecord()->size = m_used - m_record;
+        m_record = NONE;
+    }
+
+    /** Format the complete records to \c std::clog. */
+    void Flush()
+    {
+        std::size_t end = m_record == NONE ? m_used : m_record;
+        if (end == 0 || m_flushing)
+        {
+            return;
+        }
+        m_flushing = true;
+        for (std::size_t offset = 0; offset < end;)
+        {
+            const auto* record = reinterpret_cast<const Record*>(GetData() + offset);
+            Format(std::clog, record);
+            offset += record->size;
+        }
+        std::clog.flush();
+        // Move the record being recorded to the start of the buffer.
+        std::memmove(GetData(), GetData() + end, m_used - end);
+        m_used -= end;
+        if (m_record != NONE)
+        {
+            m_record = 0;
+        }
+        m_flushing = false;
+    }
+
+  private:
+    /** No record. */
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * Round a size up to the maximum alignment.
+     * @param [in] size The size.
+     * @returns The aligned size.
+     */
+    static constexpr std::size_t Align(std::size_t size)
+    {
+        return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    }
+
+    /**
+     * Make room in the buffer, flushing or growing it if needed.
+     * @param [in] size The size needed.
+     */
+    void Reserve(std::size_t size)
+    {
+        if (m_used + size <= m_capacity)
+        {
+            return;
+        }
+        std::size_t capacity =
+            std::max(m_capacity, Align(g_logBufferSize.load(std::memory_order_relaxed)));
+        if (m_used + size > capacity)
+        {
+            Flush();
+            // Only a single record larger than the buffer may make it grow.
+            capacity = std::max(capacity, Align(m_used + size));
+        }
+        if (capacity > m_capacity)
+        {
+            auto data = std::make_unique_for_overwrite<std::max_align_t[]>(
+                capacity / sizeof(std::max_align_t));
+            if (m_used > 0)
+            {
+                std::memcpy(data.get(), m_data.get(), m_used);
+            }
+            m_data = std::move(data);
+            m_capacity = capacity;
+        }
+    }
+
+    /**
+     * Format a record.
+     * @param [in,out] os The output stream.
+     * @param [in] record The record.
+     */
+    static void Format(std::ostream& os, const Record* record)
+    {
+        const char* argument = reinterpret_cast<const char*>(record) + Align(sizeof(Record));
+        const char* end = reinterpret_cast<const char*>(record) + record->size;
+        auto formatArgument = [&argument](std::ostream& os, bool parameter) {
+            const auto* header = reinterpret_cast<const Argument*>(argument);
+            header->formatter(os, argument + Align(sizeof(Argument)), parameter);
+            argument += header->size;
+        };
+
+        auto flags = os.setf(std::ios_base::boolalpha);
+        auto precision = os.precision();
+        auto fill = os.fill();
+        for (uint8_t i = 0; i < record->prefixes; ++i)
+        {
+            formatArgument(os, false);
+        }
+        if (record->parameters)
+        {
+            os << record->component->Name() << ":" << record->function << "(";
+            for (bool first = true; argument < end; first = false)
+            {
+                os << (first ? "" : ", ");
+                formatArgument(os, true);
+            }
+            os << ")";
+        }
+        else
+        {
+            if (record->prefixFunc)
+            {
+                os << record->component->Name() << ":" << record->function << "(): ";
+            }
+            if (record->prefixLevel)
+            {
+                os << "[" << LogComponent::GetLevelLabel(LogLevel(record->level)) << "] ";
+            }
+            while (argument < end)
+            {
+                formatArgument(os, false);
+            }
+        }
+        os << '\n';
+        os.flags(flags);
+        os.precision(precision);
+        os.fill(fill);
+    }
+
+    /**
+     * Get the storage of the buffer.
+     * @returns The first byte of the buffer.
+     */
+    char* GetData()
+    {
+        return reinterpret_cast<char*>(m_data.get());
+    }
+
+    std::unique_ptr<std::max_align_t[]> m_data; //!< The storage of the buffer.
+    std::size_t m_capacity{0};                  //!< The size of the buffer.
+    std::size_t m_used{0};                      //!< The size of the records.
+    std::size_t m_record{NONE};                 //!< The offset of the record being recorded.
+    bool m_flushing{false};                     //!< Whether the records are being formatted.
+};
+
+/**
+ * @ingroup logging
+ * Get the log buffer of the calling thread.
+ * This is private to the logging implementation.
+ *
+ * @returns The log buffer.
+ */
+static LogBuffer&
+GetLogBuffer()
+{
+    thread_local LogBuffer buffer;
+    return buffer;
+}
+
+void
+LogBufferEnable(uint32_t bytes)
+{
+    g_logBufferSize = bytes;
+    g_logBufferEnabled = true;
+}
+
+void
+LogBufferDisable()
+{
+    g_logBufferEnabled = false;
+    LogBufferFlush();
+}
+
+void
+LogBufferFlush()
+{
+    if (!t_logBufferDestroyed)
+    {
+        GetLogBuffer().Flush();
+    }
+}
+
+bool
+LogBufferIsActive()
+{
+    return g_logBufferEnabled.load(std::memory_order_relaxed) && !t_logBufferDestroyed &&
+           GetLogBuffer().IsIdle();
+}
+
+/**
+ * @ingroup logging
+ * Formatter of the time prefix of the records, with the default time printer.
+ * This is private to the logging implementation.
+ *
+ * @copydetails LogRecorder::Formatter
+ */
+static void
+FormatTimePrefix(std::ostream& os, const char* data, bool /* parameter */)
+{
+    PrintDefaultTime(os, TimeStep(*reinterpret_cast<const int64_t*>(data)));
+    os << " ";
+}
+
+/**
+ * @ingroup logging
+ * Formatter of the node prefix of the records, with the default node printer.
+ * This is private to the logging implementation.
+ *
+ * @copydetails LogRecorder::Formatter
+ */
+static void
+FormatNodePrefix(std::ostream& os, const char* data, bool /* parameter */)
+{
+    uint32_t context = *reinterpret_cast<const uint32_t*>(data);
+    if (context == Simulator::NO_CONTEXT)
+    {
+        os << "-1 ";
+    }
+    else
+    {
+        os << context << " ";
+    }
+}
+
+LogRecorder::LogRecorder(const LogComponent& component,
+                         uint32_t level,
+                         const char* function,
+                         bool parameters)
+    : m_parameters(false)
+{
+    LogBuffer& buffer = GetLogBuffer();
+    buffer.Begin(&component, level, function, parameters);
+    ResetScratchStream();
+    uint8_t prefixes = 0;
+    TimePrinter timePrinter = LogGetTimePrinter();
+    if (component.IsEnabled(LOG_PREFIX_TIME) && timePrinter != nullptr)
+    {
+        if (timePrinter == &DefaultTimePrinter)
+        {
+            int64_t step = Simulator::Now().GetTimeStep();
+            std::memcpy(Allocate(sizeof(step), &FormatTimePrefix), &step, sizeof(step));
+        }
+        else
+        {
+            std::ostringstream& os = GetScratchStream();
+            (*timePrinter)(os);
+            os << " ";
+            RecordString(&LogRecorder::FormatText, os.view());
+        }
+        prefixes++;
+    }
+    NodePrinter nodePrinter = LogGetNodePrinter();
+    if (component.IsEnabled(LOG_PREFIX_NODE) && nodePrinter != nullptr)
+    {
+        if (nodePrinter == &DefaultNodePrinter)
+        {
+            uint32_t context = Simulator::GetContext();
+            std::memcpy(Allocate(sizeof(context), &FormatNodePrefix), &context, sizeof(context));
+        }
+        else
+        {
+            std::ostringstream& os = GetScratchStream();
+            (*nodePrinter)(os);
+            os << " ";
+            RecordString(&LogRecorder::FormatText, os.view());
+        }
+        prefixes++;
+    }
+    buffer.GetRecord()->prefixes = prefixes;
+    m_parameters = parameters;
+}
+
+LogRecorder::~LogRecorder()
+{
+    GetLogBuffer().End();
+}
+
+LogRecorder&
+LogRecorder::operator<<(std::ostream& (*manipulator)(std::ostream&))
+{
+    std::memcpy(Allocate(sizeof(manipulator), &FormatDeferred<decltype(manipulator)>),
+                &manipulator,
+                sizeof(manipulator));
+    return *this;
+}
+
+LogRecorder&
+LogRecorder::operator<<(std::ios_base& (*manipulator)(std::ios_base&))
+{
+    std::memcpy(Allocate(sizeof(manipulator), &FormatDeferred<decltype(manipulator)>),
+                &manipulator,
+                sizeof(manipulator));
+    GetScratchStream() << manipulator;
+    return *this;
+}
+
+char*
+LogRecorder::Allocate(std::size_t size, Formatter formatter)
+{
+    return GetLogBuffer().Allocate(size, formatter);
+}
+
+void
+LogRecorder::RecordString(Formatter formatter, std::string_view s)
+{
+    uint32_t size = s.size();
+    char* data = Allocate(sizeof(size) + size, formatter);
+    std::memcpy(data, &size, sizeof(size));
+    std::memcpy(data + sizeof(size), s.data(), size);
+}
+
+/**
+ * @ingroup logging
+ * Get the scratch stream of the calling thread.
+ * This is private to the logging implementation.
+ *
+ * @returns The scratch stream.
+ */
+static std::ostringstream&
+GetThreadScratchStream()
+{
+    thread_local std::ostringstream os;
+    return os;
+}
+
+std::ostringstream&
+LogRecorder::GetScratchStream()
+{
+    std::ostringstream& os = GetThreadScratchStream();
+    os.str("");
+    os.clear();
+    return os;
+}
+
+void
+LogRecorder::ResetScratchStream()
+{
+    // The state of std::clog when LogBuffer::Format() starts a record.
+    std::ostringstream& os = GetThreadScratchStream();
+    os.flags(std::ios_base::boolalpha | std::ios_base::dec | std::ios_base::skipws);
+    os.precision(std::clog.precision());
+    os.fill(std::clog.fill());
+    os.width(0);
+}
+
+void
+LogRecorder::FormatString(std::ostream& os, const char* data, bool parameter)
+{
+    uint32_t size;
+    std::memcpy(&size, data, sizeof(size));
+    // Same as ParameterLogger.
+    if (parameter)
+    {
+        os << "\"";
+    }
+    os << std::string_view(data + sizeof(size), size);
+    if (parameter)
+    {
+        os << "\"";
+    }
+}
+
+void
+LogRecorder::FormatText(std::ostream& os, const char* data, bool /* parameter */)
+{
+    uint32_t size;
+    std::memcpy(&size, data, sizeof(size));
+    os << std::string_view(data + sizeof(size), size);
+}
+
 } // namespace ns3
@@ -9,14 +9,19 @@
 #ifndef NS3_LOG_H
 #define NS3_LOG_H
 
+#include "log-buffer-traits.h"
 #include "log-macros-disabled.h"
 #include "log-macros-enabled.h"
 #include "node-printer.h"
 #include "time-printer.h"
 
+#include <cstring>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -510,6 +515,257 @@ ParameterLogger::operator<<(const std::vector<T>& vector)
     return *this;
 }
 
+/**
+ * Record the log messages in a per-thread buffer, instead of writing
+ * them to \c std::clog.
+ *
+ * While the buffer is enabled, the NS_LOG macros store the raw values
+ * of their arguments, and the messages are only formatted when the
+ * buffer of the thread is flushed to \c std::clog: when it is full,
+ * when LogBufferFlush() is called, when the thread exits and on fatal
+ * errors.
+ *
+ * The output is the same as without the buffer, except that
+ * NS_LOG_APPEND_CONTEXT is not recorded, and that the messages of a
+ * thread are only ordered with respect to each other.  NS_LOG_UNCOND
+ * is never buffered.
+ *
+ * @param [in] bytes The size of the buffer of each thread.
+ */
+void LogBufferEnable(uint32_t bytes = 1 << 20);
+
+/**
+ * Flush the buffer of the calling thread and stop buffering the log messages.
+ */
+void LogBufferDisable();
+
+/**
+ * Format the messages recorded in the buffer of the calling thread to
+ * \c std::clog.
+ */
+void LogBufferFlush();
+
+/**
+ * Check if the log messages of the calling thread are recorded in its buffer.
+ * @returns \c true if the buffer is enabled and no message is being recorded.
+ */
+bool LogBufferIsActive();
+
+/**
+ * Record a log message in the buffer of the calling thread.
+ *
+ * The NS_LOG macros stream their arguments into a temporary LogRecorder
+ * when LogBufferIsActive(); the record is complete when the
+ * LogRecorder is destroyed.
+ */
+class LogRecorder
+{
+  public:
+    /**
+     * Formatter of a stored argument.
+     * @param [in,out] os The output stream.
+     * @param [in] data The stored argument.
+     * @param [in] parameter Whether the argument is a NS_LOG_FUNCTION parameter.
+     */
+    typedef void (*Formatter)(std::ostream& os, const char* data, bool parameter);
+
+    /**
+     * Start a record.
+     *
+     * @param [in] component The log component.
+     * @param [in] level The log level, \c LOG_FUNCTION for NS_LOG_FUNCTION.
+     * @param [in] function The name of the logging function.
+     * @param [in] parameters Whether the arguments are NS_LOG_FUNCTION parameters.
+     */
+    LogRecorder(const LogComponent& component,
+                uint32_t level,
+                const char* function,
+                bool parameters = false);
+    /** Complete the record. */
+    ~LogRecorder();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    LogRecorder(const LogRecorder&) = delete;
+    LogRecorder& operator=(const LogRecorder&) = delete;
+
+    /**
+     * Record an argument.
+     * @tparam U \deduced The type of the argument.
+     * @param [in] value The argument.
+     * @returns This LogRecorder, so it's chainable.
+     */
+    template <typename U>
+    LogRecorder& operator<<(U&& value);
+
+    /**
+     * Record a stream manipulator, such as \c std::endl.
+     * @param [in] manipulator The manipulator.
+     * @returns This LogRecorder, so it's chainable.
+     */
+    LogRecorder& operator<<(std::ostream& (*manipulator)(std::ostream&));
+
+    /**
+     * Record a stream format manipulator, such as \c std::hex.
+     * @param [in] manipulator The manipulator.
+     * @returns This LogRecorder, so it's chainable.
+     */
+    LogRecorder& operator<<(std::ios_base& (*manipulator)(std::ios_base&));
+
+  private:
+    /**
+     * Allocate an argument in the record.
+     * @param [in] size The size of the stored argument.
+     * @param [in] formatter The formatter of the argument.
+     * @returns The storage of the argument, valid until the next allocation.
+     */
+    static char* Allocate(std::size_t size, Formatter formatter);
+
+    /**
+     * Record a string argument.
+     * @param [in] formatter The formatter of the argument.
+     * @param [in] s The string.
+     */
+    static void RecordString(Formatter formatter, std::string_view s);
+
+    /**
+     * Get the stream used to format the arguments which are not deferred.
+     *
+     * The stream keeps the format state set by the manipulators recorded
+     * since the start of the record, so that these arguments are formatted
+     * as they would be on \c std::clog.
+     *
+     * @returns The emptied stream of the calling thread.
+     */
+    static std::ostringstream& GetScratchStream();
+
+    /**
+     * Reset the format state of the scratch stream, at the start of a record.
+     */
+    static void ResetScratchStream();
+
+    /**
+     * Whether \p T is the type of a manipulator of \c <iomanip> with a
+     * lasting effect on the format state, which is thus applied to the
+     * scratch stream too.  \c std::setw only applies to the next output,
+     * so it is not one of them.
+     *
+     * @tparam T \explicit The argument type.
+     */
+    template <typename T>
+    static constexpr bool IsFormatManipulator =
+        std::is_same_v<T, decltype(std::setprecision(0))> ||
+        std::is_same_v<T, decltype(std::setbase(0))> ||
+        std::is_same_v<T, decltype(std::setfill(' '))> ||
+        std::is_same_v<T, decltype(std::setiosflags(std::ios_base::fmtflags()))> ||
+        std::is_same_v<T, decltype(std::resetiosflags(std::ios_base::fmtflags()))>;
+
+    /**
+     * Formatter of the string arguments.
+     * @copydetails Formatter
+     */
+    static void FormatString(std::ostream& os, const char* data, bool parameter);
+
+    /**
+     * Formatter of the arguments formatted when logged.
+     * @copydetails Formatter
+     */
+    static void FormatText(std::ostream& os, const char* data, bool parameter);
+
+    /**
+     * Formatter of the deferred arguments.
+     * @copydetails Formatter
+     * @tparam T \explicit The argument type.
+     */
+    template <typename T>
+    static void FormatDeferred(std::ostream& os, const char* data, bool parameter);
+
+    bool m_parameters; //!< Whether the arguments are NS_LOG_FUNCTION parameters.
+};
+
+template <typename T>
+void
+LogRecorder::FormatDeferred(std::ostream& os, const char* data, bool parameter)
+{
+    using Traits = LogBufferTraits<T>;
+    const auto& value = *reinterpret_cast<const typename Traits::Stored*>(data);
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        // Same as ParameterLogger.
+        if (parameter)
+        {
+            os << +value;
+            return;
+        }
+    }
+    Traits::Print(os, value);
+}
+
+template <typename U>
+LogRecorder&
+LogRecorder::operator<<(U&& value)
+{
+    // Some operator<< take a non-const reference, so the argument is not made const.
+    using T = std::remove_cvref_t<U>;
+    using Pointee = std::remove_cv_t<std::remove_pointer_t<T>>;
+    if constexpr (std::is_pointer_v<T> && (std::is_same_v<Pointee, char> ||
+                                           std::is_same_v<Pointee, signed char> ||
+                                           std::is_same_v<Pointee, unsigned char>))
+    {
+        // Streamed as strings by std::ostream
+        RecordString(&LogRecorder::FormatString,
+                     value ? std::string_view(reinterpret_cast<const char*>(value))
+                           : std::string_view());
+    }
+    else if constexpr (std::is_array_v<T>)
+    {
+        return *this << static_cast<const std::remove_extent_t<T>*>(value);
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        RecordString(&LogRecorder::FormatString, value);
+    }
+    else if constexpr (LogBufferTraits<T>::deferred)
+    {
+        using Stored = typename LogBufferTraits<T>::Stored;
+        static_assert(std::is_trivially_copyable_v<Stored>,
+                      "The stored representation must be trivially copyable");
+        Stored stored = LogBufferTraits<T>::Store(value);
+        std::memcpy(Allocate(sizeof(Stored), &LogRecorder::FormatDeferred<T>),
+                    &stored,
+                    sizeof(Stored));
+        if constexpr (IsFormatManipulator<T>)
+        {
+            GetScratchStream() << value;
+        }
+    }
+    else
+    {
+        std::ostringstream& os = GetScratchStream();
+        if constexpr (requires(const T& constValue) { os << constValue; })
+        {
+            if (m_parameters)
+            {
+                ParameterLogger(os) << value;
+            }
+            else
+            {
+                os << value;
+            }
+        }
+        else if constexpr (requires { os << value; })
+        {
+            os << value;
+        }
+        else
+        {
+            // Only for NS_LOG_FUNCTION, e.g. a vector
+            ParameterLogger(os) << value;
+        }
+        RecordString(&LogRecorder::FormatText, os.view());
+    }
+    return *this;
+}
+
 } // namespace ns3
 
 /**@}*/ // \ingroup logging
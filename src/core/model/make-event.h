@@ -13,6 +13,8 @@
 #include <functional>
 #include <tuple>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
 
 /**
  * @file
@@ -138,10 +140,17 @@ MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
         EventMemberImpl() = delete;
 
         EventMemberImpl(OBJ obj, MEM function, Ts... args)
-            : m_function(std::bind(function, obj, args...))
+            : m_function(function),
+              m_object(obj),
+              m_arguments(args...)
         {
         }
 
+        Callee GetCallee() const override
+        {
+            return MakeCallee(m_function);
+        }
+
       protected:
         ~EventMemberImpl() override
         {
@@ -150,10 +159,14 @@ MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
       private:
         void Notify() override
         {
-            m_function();
+            std::apply([this](auto&... args) { std::invoke(m_function, m_object, args...); },
+                       m_arguments);
         }
 
-        std::function<void()> m_function;
+        MEM m_function; //!< The method.
+        OBJ m_object;   //!< The object, or a pointer to it.
+        /// The bound arguments, stored in the event to avoid a second allocation.
+        std::tuple<std::remove_reference_t<Ts>...> m_arguments;
     }* ev = new EventMemberImpl(obj, mem_ptr, args...);
 
     return ev;
@@ -172,6 +185,11 @@ MakeEvent(void (*f)(Us...), Ts... args)
         {
         }
 
+        Callee GetCallee() const override
+        {
+            return MakeCallee(m_function);
+        }
+
       protected:
         ~EventFunctionImpl() override
         {
@@ -202,6 +220,11 @@ MakeEvent(T function)
         {
         }
 
+        Callee GetCallee() const override
+        {
+            return MakeCallee(m_function);
+        }
+
         ~EventImplFunctional() override
         {
         }
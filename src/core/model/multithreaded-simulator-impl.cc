@@ -0,0 +1,740 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "multithreaded-simulator-impl.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "fatal-error.h"
+#include "log.h"
+#include "scheduler.h"
+#include "simulator.h"
+#include "uinteger.h"
+
+#include <algorithm>
+#include <optional>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3
+{
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the possibility
+// of causing recursions leading to stack overflow
+NS_LOG_COMPONENT_DEFINE("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED(MultithreadedSimulatorImpl);
+
+thread_local MultithreadedSimulatorImpl::LogicalProcess* MultithreadedSimulatorImpl::m_currentLp =
+    nullptr;
+
+/**
+ * Get the smallest lookahead bound recorded by the channels.
+ * @return The bound, if any.
+ */
+static std::optional<Time>&
+GetSimulatorLookAheadBound()
+{
+    static std::optional<Time> bound;
+    return bound;
+}
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::MultithreadedSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Core")
+            .AddConstructor<MultithreadedSimulatorImpl>()
+            .AddAttribute("LookAhead",
+                          "Minimum delay of the events scheduled for another context. "
+                          "A zero lookahead processes events sequentially.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&MultithreadedSimulatorImpl::m_lookAhead),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("MaxThreads",
+                          "Maximum number of threads running logical processes, "
+                          "including the main one (0 for one per hardware thread). "
+                          "More than one thread requires thread-safe models, which "
+                          "excludes the models exchanging packets.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&MultithreadedSimulatorImpl::m_maxThreads),
+                          MakeUintegerChecker<uint32_t>());
+    return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+    m_stop = false;
+    m_uid = EventId::UID::VALID;
+    m_currentTs = 0;
+    m_currentContext = Simulator::NO_CONTEXT;
+    m_eventsWithContext = nullptr;
+    m_lookAheadBounded = false;
+    m_window = 0;
+    m_busyWorkers = 0;
+    m_shutdown = false;
+    m_nextReady = 0;
+    m_windowEnd = 0;
+    m_parallel = false;
+    m_mainThreadId = std::this_thread::get_id();
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    StopWorkers();
+    ProcessEventsWithContext();
+
+    for (auto& [context, lp] : m_lps)
+    {
+        while (!lp->events->IsEmpty())
+        {
+            Scheduler::Event next = lp->events->RemoveNext();
+            next.impl->Unref();
+        }
+        for (auto& outgoing : lp->outgoing)
+        {
+            outgoing.event->Unref();
+        }
+        lp->events = nullptr;
+    }
+    m_lps.clear();
+    SimulatorImpl::DoDispose();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy()
+{
+    NS_LOG_FUNCTION(this);
+    // The next simulation has its own channels.
+    GetSimulatorLookAheadBound().reset();
+    while (!m_destroyEvents.empty())
+    {
+        Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
+        m_destroyEvents.pop_front();
+        NS_LOG_LOGIC("handle destroy " << ev);
+        if (!ev->IsCancelled())
+        {
+            ev->Invoke();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << schedulerFactory);
+    m_schedulerFactory = schedulerFactory;
+
+    for (auto& [context, lp] : m_lps)
+    {
+        Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler>();
+        while (!lp->events->IsEmpty())
+        {
+            Scheduler::Event next = lp->events->RemoveNext();
+            scheduler->Insert(next);
+        }
+        lp->events = scheduler;
+    }
+}
+
+// System ID for non-distributed simulation is always zero
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId() const
+{
+    return 0;
+}
+
+void
+MultithreadedSimulatorImpl::BoundLookAhead(const Time lookAhead)
+{
+    NS_LOG_FUNCTION(this << lookAhead);
+    if (lookAhead.IsStrictlyNegative())
+    {
+        NS_LOG_WARN("attempted to set lookahead to a negative time: " << lookAhead);
+        return;
+    }
+    // A zero LookAhead attribute leaves the lookahead to the bounds.
+    if ((m_lookAhead.IsZero() && !m_lookAheadBounded) || lookAhead < m_lookAhead)
+    {
+        m_lookAhead = lookAhead;
+    }
+    m_lookAheadBounded = true;
+}
+
+void
+MultithreadedSimulatorImpl::BoundSimulatorLookAhead(const Time lookAhead)
+{
+    NS_LOG_FUNCTION(lookAhead);
+    std::optional<Time>& bound = GetSimulatorLookAheadBound();
+    if (!lookAhead.IsStrictlyNegative() && (!bound || lookAhead < *bound))
+    {
+        bound = lookAhead;
+    }
+}
+
+Time
+MultithreadedSimulatorImpl::GetLookAhead() const
+{
+    return m_lookAhead;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetLogicalProcessCount() const
+{
+    return m_lps.size();
+}
+
+MultithreadedSimulatorImpl::LogicalProcess*
+MultithreadedSimulatorImpl::GetLogicalProcess(uint32_t context)
+{
+    auto it = m_lps.find(context);
+    if (it != m_lps.end())
+    {
+        return it->second.get();
+    }
+    NS_ASSERT_MSG(!m_parallel, "Logical processes cannot be created during a window");
+    auto lp = std::make_unique<LogicalProcess>();
+    lp->context = context;
+    lp->events = m_schedulerFactory.Create<Scheduler>();
+    lp->uid = EventId::UID::VALID;
+    lp->currentUid = EventId::UID::INVALID;
+    lp->currentTs = m_currentTs;
+    lp->eventCount = 0;
+    lp->unscheduledEvents = 0;
+    LogicalProcess* ret = lp.get();
+    m_lps.emplace(context, std::move(lp));
+    return ret;
+}
+
+MultithreadedSimulatorImpl::LogicalProcess*
+MultithreadedSimulatorImpl::FindLogicalProcess(uint32_t context) const
+{
+    auto it = m_lps.find(context);
+    return it == m_lps.end() ? nullptr : it->second.get();
+}
+
+Scheduler::EventKey
+MultithreadedSimulatorImpl::InsertEvent(LogicalProcess* lp, uint64_t ts, EventImpl* event)
+{
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = ts;
+    ev.key.m_context = lp->context;
+    ev.key.m_uid = lp->uid;
+    lp->uid++;
+    lp->unscheduledEvents++;
+    lp->events->Insert(ev);
+    return ev.key;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessOneEvent(LogicalProcess* lp)
+{
+    Scheduler::Event next = lp->events->RemoveNext();
+
+    PreEventHook(EventId(next.impl, next.key.m_ts, next.key.m_context, next.key.m_uid));
+
+    NS_ASSERT(next.key.m_ts >= lp->currentTs);
+    lp->unscheduledEvents--;
+    lp->eventCount++;
+
+    NS_LOG_LOGIC("handle " << next.key.m_ts);
+    lp->currentTs = next.key.m_ts;
+    lp->currentUid = next.key.m_uid;
+    InvokeEvent(next.impl, next.key.m_context);
+    next.impl->Unref();
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished() const
+{
+    if (m_stop)
+    {
+        return true;
+    }
+    for (const auto& [context, lp] : m_lps)
+    {
+        if (!lp->events->IsEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessEventsWithContext()
+{
+    if (m_eventsWithContext.load(std::memory_order_relaxed) == nullptr)
+    {
+        return;
+    }
+
+    // take the whole stack, and reverse it to get the events in the
+    // order they were scheduled
+    EventWithContext* stack = m_eventsWithContext.exchange(nullptr, std::memory_order_acquire);
+    EventWithContext* batch = nullptr;
+    while (stack != nullptr)
+    {
+        EventWithContext* next = stack->next;
+        stack->next = batch;
+        batch = stack;
+        stack = next;
+    }
+    while (batch != nullptr)
+    {
+        EventWithContext* event = batch;
+        batch = batch->next;
+        InsertEvent(GetLogicalProcess(event->context),
+                    m_currentTs + event->timestamp,
+                    event->event);
+        delete event;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::MergeOutgoingEvents()
+{
+    // Visit the logical processes in context order so that the uids
+    // assigned to the exchanged events do not depend on the thread
+    // which ran each logical process.
+    std::vector<LogicalProcess*> sources;
+    sources.reserve(m_lps.size());
+    for (auto& [context, lp] : m_lps)
+    {
+        if (!lp->outgoing.empty())
+        {
+            sources.push_back(lp.get());
+        }
+    }
+    for (auto source : sources)
+    {
+        std::vector<OutgoingEvent> outgoing;
+        outgoing.swap(source->outgoing);
+        for (const auto& ev : outgoing)
+        {
+            InsertEvent(GetLogicalProcess(ev.context), ev.timestamp, ev.event);
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessReadyLogicalProcesses()
+{
+    std::size_t index;
+    while ((index = m_nextReady.fetch_add(1)) < m_ready.size())
+    {
+        LogicalProcess* lp = m_ready[index];
+        m_currentLp = lp;
+        while (!lp->events->IsEmpty() && lp->events->PeekNext().key.m_ts < m_windowEnd)
+        {
+            ProcessOneEvent(lp);
+        }
+        m_currentLp = nullptr;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow(uint64_t windowEnd)
+{
+    m_ready.clear();
+    for (auto& [context, lp] : m_lps)
+    {
+        if (!lp->events->IsEmpty() && lp->events->PeekNext().key.m_ts < windowEnd)
+        {
+            m_ready.push_back(lp.get());
+        }
+    }
+    m_windowEnd = windowEnd;
+    m_nextReady = 0;
+    m_parallel = true;
+
+    if (m_ready.size() > 1 && !m_workers.empty())
+    {
+        {
+            std::unique_lock lock{m_workersMutex};
+            m_busyWorkers = m_workers.size();
+            m_window++;
+        }
+        m_windowReady.notify_all();
+        ProcessReadyLogicalProcesses();
+        std::unique_lock lock{m_workersMutex};
+        m_windowDone.wait(lock, [this] { return m_busyWorkers == 0; });
+    }
+    else
+    {
+        ProcessReadyLogicalProcesses();
+    }
+
+    m_parallel = false;
+    for (auto lp : m_ready)
+    {
+        m_currentTs = std::max(m_currentTs, lp->currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::WorkerThread()
+{
+    uint64_t window = 0;
+    while (true)
+    {
+        {
+            std::unique_lock lock{m_workersMutex};
+            m_windowReady.wait(lock, [this, window] { return m_shutdown || m_window != window; });
+            if (m_shutdown)
+            {
+                return;
+            }
+            window = m_window;
+        }
+        ProcessReadyLogicalProcesses();
+        {
+            std::unique_lock lock{m_workersMutex};
+            m_busyWorkers--;
+            if (m_busyWorkers == 0)
+            {
+                m_windowDone.notify_one();
+            }
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::StartWorkers()
+{
+    uint32_t threads = m_maxThreads;
+    if (threads == 0)
+    {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    m_shutdown = false;
+    m_window = 0;
+    for (uint32_t i = 1; i < threads; ++i)
+    {
+        m_workers.emplace_back(&MultithreadedSimulatorImpl::WorkerThread, this);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::StopWorkers()
+{
+    {
+        std::unique_lock lock{m_workersMutex};
+        m_shutdown = true;
+    }
+    m_windowReady.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+    m_workers.clear();
+}
+
+void
+MultithreadedSimulatorImpl::Run()
+{
+    NS_LOG_FUNCTION(this);
+    // Set the current threadId as the main threadId
+    m_mainThreadId = std::this_thread::get_id();
+    m_stop = false;
+
+    if (const auto& bound = GetSimulatorLookAheadBound())
+    {
+        BoundLookAhead(*bound);
+    }
+    bool parallel = m_lookAhead.IsStrictlyPositive();
+    if (parallel)
+    {
+        StartWorkers();
+    }
+
+    while (!m_stop)
+    {
+        ProcessEventsWithContext();
+
+        // Find the logical process with the earliest event; the
+        // NO_CONTEXT one wins ties, so that it runs alone.
+        LogicalProcess* next = nullptr;
+        uint64_t nextTs = 0;
+        for (auto& [context, lp] : m_lps)
+        {
+            if (lp->events->IsEmpty())
+            {
+                continue;
+            }
+            uint64_t ts = lp->events->PeekNext().key.m_ts;
+            if (next == nullptr || ts < nextTs ||
+                (ts == nextTs && context == Simulator::NO_CONTEXT))
+            {
+                next = lp.get();
+                nextTs = ts;
+            }
+        }
+        if (next == nullptr)
+        {
+            break;
+        }
+
+        if (!parallel || next->context == Simulator::NO_CONTEXT)
+        {
+            m_currentTs = nextTs;
+            m_currentLp = next;
+            ProcessOneEvent(next);
+            m_currentLp = nullptr;
+            continue;
+        }
+
+        uint64_t windowEnd = nextTs + m_lookAhead.GetTimeStep();
+        LogicalProcess* global = FindLogicalProcess(Simulator::NO_CONTEXT);
+        if (global != nullptr && !global->events->IsEmpty())
+        {
+            windowEnd = std::min(windowEnd, global->events->PeekNext().key.m_ts);
+        }
+        ProcessWindow(windowEnd);
+        MergeOutgoingEvents();
+    }
+
+    if (parallel)
+    {
+        StopWorkers();
+    }
+
+    // If the simulator stopped naturally by lack of events, make a
+    // consistency test to check that we didn't lose any events along the way.
+    NS_ASSERT(m_stop || std::all_of(m_lps.begin(), m_lps.end(), [](const auto& item) {
+                  return item.second->unscheduledEvents == 0;
+              }));
+}
+
+void
+MultithreadedSimulatorImpl::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    m_stop = true;
+}
+
+EventId
+MultithreadedSimulatorImpl::Stop(const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep());
+    return Simulator::Schedule(delay, &Simulator::Stop);
+}
+
+//
+// Schedule an event for a _relative_ time in the future.
+//
+EventId
+MultithreadedSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep() << event);
+    NS_ASSERT_MSG(m_currentLp != nullptr || m_mainThreadId == std::this_thread::get_id(),
+                  "Simulator::Schedule Thread-unsafe invocation!");
+
+    NS_ASSERT_MSG(delay.IsPositive(), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+    LogicalProcess* lp = m_currentLp;
+    if (lp == nullptr)
+    {
+        lp = GetLogicalProcess(m_currentContext);
+    }
+    Time tAbsolute = delay + Now();
+    Scheduler::EventKey key = InsertEvent(lp, tAbsolute.GetTimeStep(), event);
+    return EventId(event, key.m_ts, key.m_context, key.m_uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                const Time& delay,
+                                                EventImpl* event)
+{
+    NS_LOG_FUNCTION(this << context << delay.GetTimeStep() << event);
+
+    if (m_currentLp != nullptr && m_parallel)
+    {
+        // Inside a window: only the logical process of the caller can be
+        // modified, events for the other ones are merged after the window.
+        uint64_t ts = (delay + Now()).GetTimeStep();
+        if (context == m_currentLp->context)
+        {
+            InsertEvent(m_currentLp, ts, event);
+            return;
+        }
+        if (ts < m_windowEnd)
+        {
+            NS_FATAL_ERROR("Event scheduled for context "
+                           << context << " with delay " << delay
+                           << " violates the lookahead of " << m_lookAhead);
+        }
+        m_currentLp->outgoing.push_back({context, ts, event});
+    }
+    else if (m_mainThreadId == std::this_thread::get_id())
+    {
+        InsertEvent(GetLogicalProcess(context), (delay + Now()).GetTimeStep(), event);
+    }
+    else
+    {
+        auto ev = new EventWithContext;
+        ev->context = context;
+        // Current time added in ProcessEventsWithContext()
+        ev->timestamp = delay.GetTimeStep();
+        ev->event = event;
+        ev->next = m_eventsWithContext.load(std::memory_order_relaxed);
+        while (!m_eventsWithContext.compare_exchange_weak(ev->next,
+                                                          ev,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow(EventImpl* event)
+{
+    return Schedule(Time(0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy(EventImpl* event)
+{
+    NS_ASSERT_MSG(m_mainThreadId == std::this_thread::get_id() && !m_parallel,
+                  "Simulator::ScheduleDestroy Thread-unsafe invocation!");
+
+    EventId id(Ptr<EventImpl>(event, false), m_currentTs, 0xffffffff, 2);
+    m_destroyEvents.push_back(id);
+    m_uid++;
+    return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now() const
+{
+    // Do not add function logging here, to avoid stack overflow
+    return TimeStep(m_currentLp != nullptr ? m_currentLp->currentTs : m_currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft(const EventId& id) const
+{
+    if (IsExpired(id))
+    {
+        return TimeStep(0);
+    }
+    else
+    {
+        return TimeStep(id.GetTs()) - Now();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove(const EventId& id)
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        // destroy events.
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                m_destroyEvents.erase(i);
+                break;
+            }
+        }
+        return;
+    }
+    if (IsExpired(id))
+    {
+        return;
+    }
+    LogicalProcess* lp = FindLogicalProcess(id.GetContext());
+    NS_ASSERT_MSG(!m_parallel || lp == m_currentLp,
+                  "Events of another context cannot be removed while running in parallel");
+    Scheduler::Event event;
+    event.impl = id.PeekEventImpl();
+    event.key.m_ts = id.GetTs();
+    event.key.m_context = id.GetContext();
+    event.key.m_uid = id.GetUid();
+    lp->events->Remove(event);
+    event.impl->Cancel();
+    // whenever we remove an event from the event list, we have to unref it.
+    event.impl->Unref();
+
+    lp->unscheduledEvents--;
+}
+
+void
+MultithreadedSimulatorImpl::Cancel(const EventId& id)
+{
+    if (!IsExpired(id))
+    {
+        id.PeekEventImpl()->Cancel();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired(const EventId& id) const
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        if (id.PeekEventImpl() == nullptr || id.PeekEventImpl()->IsCancelled())
+        {
+            return true;
+        }
+        // destroy events.
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    const LogicalProcess* lp = FindLogicalProcess(id.GetContext());
+    return id.PeekEventImpl() == nullptr || lp == nullptr || id.GetTs() < lp->currentTs ||
+           (id.GetTs() == lp->currentTs && id.GetUid() <= lp->currentUid) ||
+           id.PeekEventImpl()->IsCancelled();
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime() const
+{
+    return TimeStep(0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext() const
+{
+    return m_currentLp != nullptr ? m_currentLp->context : m_currentContext;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount() const
+{
+    uint64_t count = 0;
+    for (const auto& [context, lp] : m_lps)
+    {
+        count += lp->eventCount;
+    }
+    return count;
+}
+
+} // namespace ns3
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "event-impl.h"
+#include "nstime.h"
+#include "object-factory.h"
+#include "scheduler.h"
+#include "simulator-impl.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup simulator
+ *
+ * A shared-memory, multi-threaded simulator implementation.
+ *
+ * Every execution context (typically the node id passed to
+ * Simulator::ScheduleWithContext) is a logical process with its own
+ * event list, clock and event uids.  Events scheduled with
+ * Simulator::Schedule stay in the logical process of the caller;
+ * events scheduled with Simulator::ScheduleWithContext for another
+ * context are handed over to the target logical process.
+ *
+ * Logical processes are run conservatively.  Each round the simulator
+ * finds the earliest pending timestamp \c T and lets every logical
+ * process with events in the window <tt>[T, T + LookAhead)</tt> run
+ * them on a pool of worker threads.  Events exchanged between logical
+ * processes during a window are merged at the end of the window, in a
+ * deterministic order, so the results do not depend on the number of
+ * threads.  Events scheduled in the Simulator::NO_CONTEXT context
+ * (e.g., from the main program) always run alone, once every logical
+ * process has reached their timestamp.
+ *
+ * The lookahead must be a lower bound on the delay of every event
+ * scheduled for another context, usually the smallest channel
+ * propagation delay in the topology.  It can be set through the
+ * \c LookAhead attribute and is lowered by BoundLookAhead() and
+ * BoundSimulatorLookAhead().  The point-to-point and CSMA channels call
+ * the latter with their delay when a device is attached, and the Yans and
+ * spectrum channels call it with zero, since their propagation delay can
+ * be arbitrarily small.  A cross-context
+ * event which would land inside the current window is a fatal error.
+ * With a zero lookahead (the default, if no channel bounds it) events
+ * are processed one at a time in timestamp order, which is always
+ * correct but cannot be parallelized.
+ *
+ * The logical processes of a window only run on several threads if the
+ * \c MaxThreads attribute is not 1 (the default).  This requires models
+ * which only share state between nodes through events scheduled with
+ * Simulator::ScheduleWithContext: objects touched from several contexts
+ * in the same window, including their reference counts, are accessed
+ * concurrently.  The network module does not qualify: the free lists of
+ * Buffer and PacketMetadata, the tags of PacketTagList and the reference
+ * counts of SimpleRefCount are not thread-safe, so simulations which
+ * exchange packets must keep a single thread.  PreEventHook() is called
+ * from the worker threads as well, so subclasses overriding it must keep
+ * a single thread too, unless it is thread-safe.
+ *
+ * Simulator::Stop() called from an event of a window takes effect at the
+ * end of the window: the other logical processes still run their events
+ * of the window, so that the results do not depend on the number of
+ * threads.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+  public:
+    /**
+     *  Register this type.
+     *  @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    MultithreadedSimulatorImpl();
+    /** Destructor. */
+    ~MultithreadedSimulatorImpl() override;
+
+    // Inherited
+    void Destroy() override;
+    bool IsFinished() const override;
+    void Stop() override;
+    EventId Stop(const Time& delay) override;
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    EventId ScheduleNow(EventImpl* event) override;
+    EventId ScheduleDestroy(EventImpl* event) override;
+    void Remove(const EventId& id) override;
+    void Cancel(const EventId& id) override;
+    bool IsExpired(const EventId& id) const override;
+    void Run() override;
+    Time Now() const override;
+    Time GetDelayLeft(const EventId& id) const override;
+    Time GetMaximumSimulationTime() const override;
+    void SetScheduler(ObjectFactory schedulerFactory) override;
+    uint32_t GetSystemId() const override;
+    uint32_t GetContext() const override;
+    uint64_t GetEventCount() const override;
+
+    /**
+     * Lower the lookahead used to size the parallel windows.
+     *
+     * Channels call this with their minimum propagation delay.  The
+     * lookahead is the smallest of the bounds and of the \c LookAhead
+     * attribute, if it is positive.  A zero bound makes the events run
+     * sequentially; negative values are ignored.
+     *
+     * @param [in] lookAhead The minimum delay of any event exchanged
+     *             between contexts.
+     */
+    void BoundLookAhead(const Time lookAhead);
+
+    /**
+     * Bound the lookahead of the simulation, if it runs on a
+     * MultithreadedSimulatorImpl.
+     *
+     * This is called by the channels when a device is attached.  It does
+     * not create the simulator implementation: the bound is recorded, and
+     * applied through BoundLookAhead() when the simulation runs, until
+     * the simulator is destroyed.
+     *
+     * @param [in] lookAhead The minimum delay of any event exchanged
+     *             between contexts through the caller.
+     */
+    static void BoundSimulatorLookAhead(const Time lookAhead);
+
+    /**
+     * Get the lookahead currently in use.
+     * @return The lookahead.
+     */
+    Time GetLookAhead() const;
+
+    /**
+     * Get the number of logical processes (distinct contexts) seen so far.
+     * @return The number of logical processes.
+     */
+    uint32_t GetLogicalProcessCount() const;
+
+  private:
+    void DoDispose() override;
+
+    /** An event scheduled for another logical process during a window. */
+    struct OutgoingEvent
+    {
+        /** The target context. */
+        uint32_t context;
+        /** Absolute event timestamp. */
+        uint64_t timestamp;
+        /** The event implementation. */
+        EventImpl* event;
+    };
+
+    /** The state of one execution context. */
+    struct LogicalProcess
+    {
+        /** The context of every event in this logical process. */
+        uint32_t context;
+        /** The event priority queue. */
+        Ptr<Scheduler> events;
+        /** Next event unique id. */
+        uint32_t uid;
+        /** Unique id of the current event. */
+        uint32_t currentUid;
+        /** Timestamp of the current event. */
+        uint64_t currentTs;
+        /** The event count. */
+        uint64_t eventCount;
+        /** Number of events that have been inserted but not yet scheduled. */
+        int unscheduledEvents;
+        /** Events for other logical processes, merged at the end of the window. */
+        std::vector<OutgoingEvent> outgoing;
+    };
+
+    /**
+     * Get the logical process of a context, creating it if needed.
+     * Must only be called from the main thread outside of a window.
+     * @param [in] context The context.
+     * @return The logical process.
+     */
+    LogicalProcess* GetLogicalProcess(uint32_t context);
+    /**
+     * Get the logical process of a context.
+     * @param [in] context The context.
+     * @return The logical process, or \c nullptr if it does not exist.
+     */
+    LogicalProcess* FindLogicalProcess(uint32_t context) const;
+    /**
+     * Insert an event in a logical process.
+     * @param [in] lp The logical process.
+     * @param [in] ts The absolute event timestamp.
+     * @param [in] event The event implementation.
+     * @return The key of the inserted event.
+     */
+    Scheduler::EventKey InsertEvent(LogicalProcess* lp, uint64_t ts, EventImpl* event);
+    /**
+     * Process the next event of a logical process.
+     * @param [in] lp The logical process.
+     */
+    void ProcessOneEvent(LogicalProcess* lp);
+    /**
+     * Run the events of every logical process up to the end of the window.
+     * @param [in] windowEnd The (excluded) end of the window.
+     */
+    void ProcessWindow(uint64_t windowEnd);
+    /** Run the logical processes of the current window until none is left. */
+    void ProcessReadyLogicalProcesses();
+    /** Move the events exchanged during the last window to their logical process. */
+    void MergeOutgoingEvents();
+    /** Move events from a foreign thread into the event queues. */
+    void ProcessEventsWithContext();
+    /** Start the worker threads. */
+    void StartWorkers();
+    /** Stop and join the worker threads. */
+    void StopWorkers();
+    /** Worker thread main loop. */
+    void WorkerThread();
+
+    /**
+     * Wrap an event with its execution context.
+     *
+     * The wrappers are allocated from the pool of EventImpl, which
+     * recycles the blocks released by the main thread.
+     */
+    struct EventWithContext
+    {
+        /** The event context. */
+        uint32_t context;
+        /** Event timestamp. */
+        uint64_t timestamp;
+        /** The event implementation. */
+        EventImpl* event;
+        /** The previously pushed event. */
+        EventWithContext* next;
+
+        /**
+         * Allocate a wrapper from the event pool.
+         * @param [in] size The size of the wrapper.
+         * @returns The storage.
+         */
+        static void* operator new(std::size_t size)
+        {
+            return EventImpl::operator new(size);
+        }
+
+        /**
+         * Release a wrapper to the event pool.
+         * @param [in] p The storage.
+         * @param [in] size The size of the wrapper.
+         */
+        static void operator delete(void* p, std::size_t size)
+        {
+            EventImpl::operator delete(p, size);
+        }
+    };
+
+    /**
+     * The events from a foreign thread, as a lock-free stack, as in
+     * DefaultSimulatorImpl.
+     */
+    std::atomic<EventWithContext*> m_eventsWithContext;
+
+    /** Container type for the events to run at Simulator::Destroy() */
+    typedef std::list<EventId> DestroyEvents;
+    /** The container of events to run at Destroy. */
+    DestroyEvents m_destroyEvents;
+    /** Flag calling for the end of the simulation. */
+    std::atomic<bool> m_stop;
+    /** The factory used to create the event list of each logical process. */
+    ObjectFactory m_schedulerFactory;
+    /** The logical processes, indexed by context. */
+    std::map<uint32_t, std::unique_ptr<LogicalProcess>> m_lps;
+
+    /** Timestamp of the last processed window or sequential event. */
+    uint64_t m_currentTs;
+    /** Execution context outside of any event. */
+    uint32_t m_currentContext;
+    /** Next uid of the events run at Destroy. */
+    uint32_t m_uid;
+
+    /** The minimum delay of any event scheduled for another context. */
+    Time m_lookAhead;
+    /** Whether BoundLookAhead() has been called. */
+    bool m_lookAheadBounded;
+    /** Maximum number of threads, including the main one (0 for one per core). */
+    uint32_t m_maxThreads;
+
+    /** The worker threads. */
+    std::vector<std::thread> m_workers;
+    /** Mutex protecting the worker synchronization state. */
+    std::mutex m_workersMutex;
+    /** Notify the workers that a window is ready, or that they must exit. */
+    std::condition_variable m_windowReady;
+    /** Notify the main thread that every worker is done with the window. */
+    std::condition_variable m_windowDone;
+    /** Window counter, used by the workers to detect a new window. */
+    uint64_t m_window;
+    /** Number of workers still busy with the current window. */
+    uint32_t m_busyWorkers;
+    /** Flag asking the workers to exit. */
+    bool m_shutdown;
+    /** Logical processes with events in the current window. */
+    std::vector<LogicalProcess*> m_ready;
+    /** Index of the next logical process to run in m_ready. */
+    std::atomic<std::size_t> m_nextReady;
+    /** The (excluded) end of the current window. */
+    uint64_t m_windowEnd;
+    /** Flag \c true while logical processes run concurrently. */
+    bool m_parallel;
+
+    /** The logical process whose event is running on this thread. */
+    static thread_local LogicalProcess* m_currentLp;
+
+    /** Main execution thread. */
+    std::thread::id m_mainThreadId;
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
@@ -13,6 +13,7 @@
 #include "attribute.h"
 #include "event-id.h"
 #include "int64x64.h"
+#include "log-buffer-traits.h"
 #include "type-name.h"
 
 #include "ns3/core-export.h"
@@ -91,6 +92,16 @@ class TimeWithUnit;
  * resolution.  Therefore the maximum possible duration of your simulation
  * if you use picoseconds is 2^64 ps = 2^24 s = 7 months, whereas,
  * had you used nanoseconds, you could have run for 584 years.
+ *
+ * Times built from a raw value in the current resolution, such as
+ * TimeStep(), Time::Max() or \c Time(0), can be \c constexpr, as can the
+ * comparison, addition and integer scaling of Times:
+ * @code
+ * constexpr Time maxDelay = Time::Max() - TimeStep(1);
+ * @endcode
+ * The Times created in a unit, such as Seconds(), depend on the resolution
+ * and cannot be constant expressions.  A \c constexpr Time is not tracked
+ * by SetResolution(), so it must be in the final resolution.
  */
 class CORE_EXPORT Time
 {
@@ -119,19 +130,22 @@ class CORE_EXPORT Time
      * @param [in] o Time to assign.
      * @return The Time.
      */
-    inline Time& operator=(const Time& o)
+    constexpr Time& operator=(const Time& o)
     {
         m_data = o.m_data;
         return *this;
     }
 
     /** Default constructor, with value 0. */
-    inline Time()
+    constexpr Time()
         : m_data()
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Mark(this);
+            if (MarkingTimes())
+            {
+                Mark(this);
+            }
         }
     }
 
@@ -140,12 +154,15 @@ class CORE_EXPORT Time
      *
      * @param [in] o Time to copy
      */
-    inline Time(const Time& o)
+    constexpr Time(const Time& o)
         : m_data(o.m_data)
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Mark(this);
+            if (MarkingTimes())
+            {
+                Mark(this);
+            }
         }
     }
 
@@ -154,12 +171,15 @@ class CORE_EXPORT Time
      *
      * @param [in] o Time from which take the data
      */
-    Time(Time&& o)
+    constexpr Time(Time&& o)
         : m_data(o.m_data)
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Mark(this);
+            if (MarkingTimes())
+            {
+                Mark(this);
+            }
         }
     }
 
@@ -182,57 +202,75 @@ class CORE_EXPORT Time
         }
     }
 
-    explicit inline Time(int v)
+    explicit constexpr Time(int v)
         : m_data(v)
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Mark(this);
+            if (MarkingTimes())
+            {
+                Mark(this);
+            }
         }
     }
 
-    explicit inline Time(long int v)
+    explicit constexpr Time(long int v)
         : m_data(v)
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Mark(this);
+            if (MarkingTimes())
+            {
+                Mark(this);
+            }
         }
     }
 
-    explicit inline Time(long long int v)
+    explicit constexpr Time(long long int v)
         : m_data(v)
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Mark(this);
+            if (MarkingTimes())
+            {
+                Mark(this);
+            }
         }
     }
 
-    explicit inline Time(unsigned int v)
+    explicit constexpr Time(unsigned int v)
         : m_data(v)
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Mark(this);
+            if (MarkingTimes())
+            {
+                Mark(this);
+            }
         }
     }
 
-    explicit inline Time(unsigned long int v)
+    explicit constexpr Time(unsigned long int v)
         : m_data(v)
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Mark(this);
+            if (MarkingTimes())
+            {
+                Mark(this);
+            }
         }
     }
 
-    explicit inline Time(unsigned long long int v)
+    explicit constexpr Time(unsigned long long int v)
         : m_data(v)
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Mark(this);
+            if (MarkingTimes())
+            {
+                Mark(this);
+            }
         }
     }
 
@@ -275,7 +313,7 @@ class CORE_EXPORT Time
      * Not to be confused with Min(Time,Time).
      * @returns the minimum representable Time.
      */
-    static Time Min()
+    static constexpr Time Min()
     {
         return Time(std::numeric_limits<int64_t>::min());
     }
@@ -285,17 +323,20 @@ class CORE_EXPORT Time
      * Not to be confused with Max(Time,Time).
      * @returns the maximum representable Time.
      */
-    static Time Max()
+    static constexpr Time Max()
     {
         return Time(std::numeric_limits<int64_t>::max());
     }
 
     /** Destructor */
-    ~Time()
+    constexpr ~Time()
     {
-        if (MarkingTimes())
+        if !consteval
         {
-            Clear(this);
+            if (MarkingTimes())
+            {
+                Clear(this);
+            }
         }
     }
 
@@ -303,7 +344,7 @@ class CORE_EXPORT Time
      * Exactly equivalent to `t == 0`.
      * @return \c true if the time is zero, \c false otherwise.
      */
-    inline bool IsZero() const
+    constexpr bool IsZero() const
     {
         return m_data == 0;
     }
@@ -312,7 +353,7 @@ class CORE_EXPORT Time
      * Exactly equivalent to `t <= 0`.
      * @return \c true if the time is negative or zero, \c false otherwise.
      */
-    inline bool IsNegative() const
+    constexpr bool IsNegative() const
     {
         return m_data <= 0;
     }
@@ -321,7 +362,7 @@ class CORE_EXPORT Time
      * Exactly equivalent to `t >= 0`.
      * @return \c true if the time is positive or zero, \c false otherwise.
      */
-    inline bool IsPositive() const
+    constexpr bool IsPositive() const
     {
         return m_data >= 0;
     }
@@ -330,7 +371,7 @@ class CORE_EXPORT Time
      * Exactly equivalent to `t < 0`.
      * @return \c true if the time is strictly negative, \c false otherwise.
      */
-    inline bool IsStrictlyNegative() const
+    constexpr bool IsStrictlyNegative() const
     {
         return m_data < 0;
     }
@@ -339,7 +380,7 @@ class CORE_EXPORT Time
      * Exactly equivalent to `t > 0`.
      * @return \c true if the time is strictly positive, \c false otherwise.
      */
-    inline bool IsStrictlyPositive() const
+    constexpr bool IsStrictlyPositive() const
     {
         return m_data > 0;
     }
@@ -350,7 +391,7 @@ class CORE_EXPORT Time
      * @param [in] o The other Time
      * @return -1,0,+1 if `this < o`, `this == o`, or `this > o`
      */
-    inline int Compare(const Time& o) const
+    constexpr int Compare(const Time& o) const
     {
         return (m_data < o.m_data) ? -1 : (m_data == o.m_data) ? 0 : 1;
     }
@@ -433,17 +474,17 @@ class CORE_EXPORT Time
      * Get the raw time value, in the current resolution unit.
      * @returns The raw time value
      */
-    inline int64_t GetTimeStep() const
+    constexpr int64_t GetTimeStep() const
     {
         return m_data;
     }
 
-    inline double GetDouble() const
+    constexpr double GetDouble() const
     {
         return static_cast<double>(m_data);
     }
 
-    inline int64_t GetInteger() const
+    constexpr int64_t GetInteger() const
     {
         return GetTimeStep();
     }
@@ -759,9 +800,18 @@ class CORE_EXPORT Time
      *  before calling Mark(). Likewise, the dtor also needs to check before
      *  calling Clear(). On Windows, attempting to access g_markingTimes
      *  directly from outside the compilation unit is an access violation so
-     *  this method is provided to work around that limitation.
+     *  this method is provided to work around that limitation.  Elsewhere
+     *  it is inline, to spare a function call to every Time constructor
+     *  and destructor.
      */
+#ifdef __WIN32__
     static bool MarkingTimes();
+#else
+    static inline bool MarkingTimes()
+    {
+        return (g_markingTimes != nullptr);
+    }
+#endif
 
   public:
     /**
@@ -811,12 +861,12 @@ class CORE_EXPORT Time
      * @name Comparison operators
      * @{
      */
-    friend bool operator==(const Time& lhs, const Time& rhs);
-    friend bool operator!=(const Time& lhs, const Time& rhs);
-    friend bool operator<=(const Time& lhs, const Time& rhs);
-    friend bool operator>=(const Time& lhs, const Time& rhs);
-    friend bool operator<(const Time& lhs, const Time& rhs);
-    friend bool operator>(const Time& lhs, const Time& rhs);
+    friend constexpr bool operator==(const Time& lhs, const Time& rhs);
+    friend constexpr bool operator!=(const Time& lhs, const Time& rhs);
+    friend constexpr bool operator<=(const Time& lhs, const Time& rhs);
+    friend constexpr bool operator>=(const Time& lhs, const Time& rhs);
+    friend constexpr bool operator<(const Time& lhs, const Time& rhs);
+    friend constexpr bool operator>(const Time& lhs, const Time& rhs);
     friend bool operator<(const Time& time, const EventId& event);
     /**@}*/ // Comparison operators
 
@@ -824,18 +874,18 @@ class CORE_EXPORT Time
      * @name Arithmetic operators
      * @{
      */
-    friend Time operator+(const Time& lhs, const Time& rhs);
-    friend Time operator-(const Time& lhs, const Time& rhs);
+    friend constexpr Time operator+(const Time& lhs, const Time& rhs);
+    friend constexpr Time operator-(const Time& lhs, const Time& rhs);
     friend Time operator*(const Time& lhs, const int64x64_t& rhs);
     friend Time operator*(const int64x64_t& lhs, const Time& rhs);
     friend int64x64_t operator/(const Time& lhs, const Time& rhs);
     friend Time operator/(const Time& lhs, const int64x64_t& rhs);
-    friend Time operator%(const Time& lhs, const Time& rhs);
-    friend int64_t Div(const Time& lhs, const Time& rhs);
-    friend Time Rem(const Time& lhs, const Time& rhs);
+    friend constexpr Time operator%(const Time& lhs, const Time& rhs);
+    friend constexpr int64_t Div(const Time& lhs, const Time& rhs);
+    friend constexpr Time Rem(const Time& lhs, const Time& rhs);
 
     template <class T>
-    friend std::enable_if_t<std::is_integral_v<T>, Time> operator*(const Time& lhs, T rhs);
+    friend constexpr std::enable_if_t<std::is_integral_v<T>, Time> operator*(const Time& lhs, T rhs);
 
     // Reversed arg version (forwards to `rhs * lhs`)
     // Accepts both integers and decimal types
@@ -843,11 +893,11 @@ class CORE_EXPORT Time
     friend std::enable_if_t<std::is_arithmetic_v<T>, Time> operator*(T lhs, const Time& rhs);
 
     template <class T>
-    friend std::enable_if_t<std::is_integral_v<T>, Time> operator/(const Time& lhs, T rhs);
+    friend constexpr std::enable_if_t<std::is_integral_v<T>, Time> operator/(const Time& lhs, T rhs);
 
-    friend Time Abs(const Time& time);
-    friend Time Max(const Time& timeA, const Time& timeB);
-    friend Time Min(const Time& timeA, const Time& timeB);
+    friend constexpr Time Abs(const Time& time);
+    friend constexpr Time Max(const Time& timeA, const Time& timeB);
+    friend constexpr Time Min(const Time& timeA, const Time& timeB);
 
     /**@}*/ // Arithmetic operators
 
@@ -861,8 +911,8 @@ class CORE_EXPORT Time
      * @name Compound assignment operators
      * @{
      */
-    friend Time& operator+=(Time& lhs, const Time& rhs);
-    friend Time& operator-=(Time& lhs, const Time& rhs);
+    friend constexpr Time& operator+=(Time& lhs, const Time& rhs);
+    friend constexpr Time& operator-=(Time& lhs, const Time& rhs);
     /**@}*/ // Compound assignment
 
     int64_t m_data; //!< Virtual time value, in the current unit.
@@ -896,7 +946,7 @@ static bool g_TimeStaticInit [[maybe_unused]] = Time::StaticInit();
  * @param [in] rhs The second value
  * @returns \c true if the two input values are equal.
  */
-inline bool
+constexpr bool
 operator==(const Time& lhs, const Time& rhs)
 {
     return lhs.m_data == rhs.m_data;
@@ -908,7 +958,7 @@ operator==(const Time& lhs, const Time& rhs)
  * @param [in] rhs The second value
  * @returns \c true if the two input values not are equal.
  */
-inline bool
+constexpr bool
 operator!=(const Time& lhs, const Time& rhs)
 {
     return lhs.m_data != rhs.m_data;
@@ -920,7 +970,7 @@ operator!=(const Time& lhs, const Time& rhs)
  * @param [in] rhs The second value
  * @returns \c true if the first input value is less than or equal to the second input value.
  */
-inline bool
+constexpr bool
 operator<=(const Time& lhs, const Time& rhs)
 {
     return lhs.m_data <= rhs.m_data;
@@ -932,7 +982,7 @@ operator<=(const Time& lhs, const Time& rhs)
  * @param [in] rhs The second value
  * @returns \c true if the first input value is greater than or equal to the second input value.
  */
-inline bool
+constexpr bool
 operator>=(const Time& lhs, const Time& rhs)
 {
     return lhs.m_data >= rhs.m_data;
@@ -944,7 +994,7 @@ operator>=(const Time& lhs, const Time& rhs)
  * @param [in] rhs The second value
  * @returns \c true if the first input value is less than the second input value.
  */
-inline bool
+constexpr bool
 operator<(const Time& lhs, const Time& rhs)
 {
     return lhs.m_data < rhs.m_data;
@@ -956,7 +1006,7 @@ operator<(const Time& lhs, const Time& rhs)
  * @param [in] rhs The second value
  * @returns \c true if the first input value is greater than the second input value.
  */
-inline bool
+constexpr bool
 operator>(const Time& lhs, const Time& rhs)
 {
     return lhs.m_data > rhs.m_data;
@@ -997,7 +1047,7 @@ operator<(const Time& time, const EventId& event)
  * @param [in] rhs The second value
  * @returns The sum of the two input values.
  */
-inline Time
+constexpr Time
 operator+(const Time& lhs, const Time& rhs)
 {
     return Time(lhs.m_data + rhs.m_data);
@@ -1009,7 +1059,7 @@ operator+(const Time& lhs, const Time& rhs)
  * @param [in] rhs The second value
  * @returns The difference of the two input values.
  */
-inline Time
+constexpr Time
 operator-(const Time& lhs, const Time& rhs)
 {
     return Time(lhs.m_data - rhs.m_data);
@@ -1051,7 +1101,7 @@ operator*(const int64x64_t& lhs, const Time& rhs)
  * @returns A new Time instance containing the scaled value
  */
 template <class T>
-std::enable_if_t<std::is_integral_v<T>, Time>
+constexpr std::enable_if_t<std::is_integral_v<T>, Time>
 operator*(const Time& lhs, T rhs)
 {
     static_assert(!std::is_same_v<T, bool>, "Multiplying a Time by a boolean is not supported");
@@ -1137,7 +1187,7 @@ operator/(const Time& lhs, const int64x64_t& rhs)
  * @returns A new Time instance containing the scaled value
  */
 template <class T>
-std::enable_if_t<std::is_integral_v<T>, Time>
+constexpr std::enable_if_t<std::is_integral_v<T>, Time>
 operator/(const Time& lhs, T rhs)
 {
     static_assert(!std::is_same_v<T, bool>, "Dividing a Time by a boolean is not supported");
@@ -1166,13 +1216,13 @@ operator/(const Time& lhs, T rhs)
  * @returns The remainder of `lhs / rhs`.
  * @{
  */
-inline Time
+constexpr Time
 operator%(const Time& lhs, const Time& rhs)
 {
     return Time(lhs.m_data % rhs.m_data);
 }
 
-inline Time
+constexpr Time
 Rem(const Time& lhs, const Time& rhs)
 {
     return Time(lhs.m_data % rhs.m_data);
@@ -1200,7 +1250,7 @@ Rem(const Time& lhs, const Time& rhs)
  *
  * @see Rem()
  */
-inline int64_t
+constexpr int64_t
 Div(const Time& lhs, const Time& rhs)
 {
     return lhs.m_data / rhs.m_data;
@@ -1212,7 +1262,7 @@ Div(const Time& lhs, const Time& rhs)
  * @param [in] rhs The second value
  * @returns The sum of the two inputs.
  */
-inline Time&
+constexpr Time&
 operator+=(Time& lhs, const Time& rhs)
 {
     lhs.m_data += rhs.m_data;
@@ -1225,7 +1275,7 @@ operator+=(Time& lhs, const Time& rhs)
  * @param [in] rhs The second value
  * @returns The difference of the two operands.
  */
-inline Time&
+constexpr Time&
 operator-=(Time& lhs, const Time& rhs)
 {
     lhs.m_data -= rhs.m_data;
@@ -1237,7 +1287,7 @@ operator-=(Time& lhs, const Time& rhs)
  * @param [in] time The Time value
  * @returns The absolute value of the input.
  */
-inline Time
+constexpr Time
 Abs(const Time& time)
 {
     return Time((time.m_data < 0) ? -time.m_data : time.m_data);
@@ -1249,7 +1299,7 @@ Abs(const Time& time)
  * @param [in] timeB The second value
  * @returns The larger of the two operands.
  */
-inline Time
+constexpr Time
 Max(const Time& timeA, const Time& timeB)
 {
     return Time((timeA.m_data < timeB.m_data) ? timeB : timeA);
@@ -1261,7 +1311,7 @@ Max(const Time& timeA, const Time& timeB)
  * @param [in] timeB The second value
  * @returns The smaller of the two operands.
  */
-inline Time
+constexpr Time
 Min(const Time& timeA, const Time& timeB)
 {
     return Time((timeA.m_data > timeB.m_data) ? timeB : timeA);
@@ -1447,7 +1497,7 @@ FemtoSeconds(int64x64_t value)
  * @return A Time.
  * @relates Time
  */
-inline Time
+constexpr Time
 TimeStep(uint64_t ts)
 {
     return Time(ts);
@@ -1534,6 +1584,41 @@ class TimeWithUnit
  */
 TYPENAMEGET_DEFINE(Time);
 
+/**
+ * @ingroup time
+ *
+ * ns3::LogBufferTraits<Time> specialization: the time step is stored
+ * in the log buffer, and the Time is formatted when the buffer is flushed.
+ */
+template <>
+struct LogBufferTraits<Time>
+{
+    /** Whether the formatting of the argument is deferred to the flush. */
+    static constexpr bool deferred = true;
+    /** The stored representation. */
+    using Stored = int64_t;
+
+    /**
+     * Get the stored representation of a Time.
+     * @param [in] time The Time.
+     * @returns The time step.
+     */
+    static Stored Store(const Time& time)
+    {
+        return time.GetTimeStep();
+    }
+
+    /**
+     * Format a stored Time.
+     * @param [in,out] os The output stream.
+     * @param [in] step The time step.
+     */
+    static void Print(std::ostream& os, Stored step)
+    {
+        os << Time(step);
+    }
+};
+
 } // namespace ns3
 
 #endif /* TIME_H */
@@ -379,7 +379,7 @@ RealtimeSimulatorImpl::ProcessOneEvent()
 
     EventImpl* event = next.impl;
     m_synchronizer->EventStart();
-    event->Invoke();
+    InvokeEvent(event, next.key.m_context);
     m_synchronizer->EventEnd();
     event->Unref();
 }
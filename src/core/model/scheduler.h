@@ -100,6 +100,14 @@ class EventImpl;
  *      <td class="markdownTableBodyLeft"> 0 </td>
  * </tr>
  * <tr class="markdownTableBody">
+ *      <td class="markdownTableBodyLeft"> LadderScheduler </td>
+ *      <td class="markdownTableBodyLeft"> `std::vector<std::vector>` tiers </td>
+ *      <td class="markdownTableBodyLeft"> Amortized constant, logarithmic worst case </td>
+ *      <td class="markdownTableBodyLeft"> Amortized constant, logarithmic worst case </td>
+ *      <td class="markdownTableBodyLeft"> 120 bytes </td>
+ *      <td class="markdownTableBodyLeft"> 0 </td>
+ * </tr>
+ * <tr class="markdownTableBody">
  *      <td class="markdownTableBodyLeft"> ListScheduler </td>
  *      <td class="markdownTableBodyLeft"> `std::list` </td>
  *      <td class="markdownTableBodyLeft"> Linear </td>
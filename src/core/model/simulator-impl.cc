@@ -7,7 +7,9 @@
 
 #include "simulator-impl.h"
 
+#include "fatal-error.h"
 #include "log.h"
+#include "string.h"
 
 /**
  * @file
@@ -25,8 +27,68 @@ NS_OBJECT_ENSURE_REGISTERED(SimulatorImpl);
 TypeId
 SimulatorImpl::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::SimulatorImpl").SetParent<Object>().SetGroupName("Core");
+    static TypeId tid =
+        TypeId("ns3::SimulatorImpl")
+            .SetParent<Object>()
+            .SetGroupName("Core")
+            .AddAttribute("EventProfile",
+                          "The file in which the EventProfiler writes the wall-clock cost of the "
+                          "events, in JSON if it ends with .json and CSV otherwise. "
+                          "Profiling is disabled if empty.",
+                          StringValue(""),
+                          MakeStringAccessor(&SimulatorImpl::SetEventProfile),
+                          MakeStringChecker());
     return tid;
 }
 
+void
+SimulatorImpl::SetEventProfile(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    m_eventProfile = filename;
+    if (filename.empty())
+    {
+        m_profiler.reset();
+    }
+    else if (!m_profiler)
+    {
+        m_profiler = std::make_unique<EventProfiler>();
+    }
+}
+
+void
+SimulatorImpl::InvokeWithContext(uint32_t context, EventImpl* event)
+{
+    NS_FATAL_ERROR(GetInstanceTypeId().GetName() << " cannot invoke events of other contexts");
+}
+
+EventProfiler*
+SimulatorImpl::GetEventProfiler() const
+{
+    return m_profiler.get();
+}
+
+TimerCoalescer&
+SimulatorImpl::GetTimerCoalescer()
+{
+    if (!m_timerCoalescer)
+    {
+        m_timerCoalescer = std::make_unique<TimerCoalescer>(this);
+    }
+    return *m_timerCoalescer;
+}
+
+void
+SimulatorImpl::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_profiler)
+    {
+        m_profiler->Write(m_eventProfile);
+        m_profiler.reset();
+    }
+    m_timerCoalescer.reset();
+    Object::DoDispose();
+}
+
 } // namespace ns3
@@ -11,10 +11,15 @@
 
 #include "event-id.h"
 #include "event-impl.h"
+#include "event-profiler.h"
 #include "nstime.h"
 #include "object-factory.h"
 #include "object.h"
 #include "ptr.h"
+#include "timer-coalescer.h"
+
+#include <memory>
+#include <string>
 
 /**
  * @file
@@ -98,6 +103,84 @@ class SimulatorImpl : public Object
     virtual void PreEventHook(const EventId& id)
     {
     }
+
+    /**
+     * Check if InvokeWithContext() is supported.
+     *
+     * @returns \c true if an event can invoke events of other contexts.
+     */
+    virtual bool CanInvokeWithContext() const
+    {
+        return false;
+    }
+
+    /**
+     * Invoke an event now, in another context, from the event being processed.
+     *
+     * The event runs as if it were the next event of the given context,
+     * and the context of the caller is restored afterwards.  This lets a
+     * single scheduled event fan out to events of many contexts.  The
+     * event shares the time and uid of the event being processed, which
+     * are also passed to PreEventHook() for it.  It is counted by
+     * GetEventCount() and profiled as an event of its own, its cost being
+     * excluded from the cost of the caller.
+     *
+     * This is only valid if CanInvokeWithContext() returns \c true.
+     *
+     * @param [in] context The context of the event.
+     * @param [in] event The event.
+     */
+    virtual void InvokeWithContext(uint32_t context, EventImpl* event);
+
+    /**
+     * Get the event profiler.
+     *
+     * @returns The event profiler, or nullptr if profiling is disabled.
+     */
+    EventProfiler* GetEventProfiler() const;
+
+    /**
+     * Get the TimerCoalescer of this simulator, creating it if needed.
+     *
+     * @returns The TimerCoalescer.
+     */
+    TimerCoalescer& GetTimerCoalescer();
+
+  protected:
+    void DoDispose() override;
+
+    /**
+     * Invoke an event, through the EventProfiler if it is enabled.
+     *
+     * @param [in] event The event.
+     * @param [in] context The context of the event.
+     */
+    void InvokeEvent(EventImpl* event, uint32_t context)
+    {
+        if (m_profiler)
+        {
+            m_profiler->Invoke(event, context);
+        }
+        else
+        {
+            event->Invoke();
+        }
+    }
+
+  private:
+    /**
+     * Set the event profile output file, enabling the EventProfiler.
+     *
+     * @param [in] filename The output file name, empty to disable profiling.
+     */
+    void SetEventProfile(const std::string& filename);
+
+    /** The event profile output file. */
+    std::string m_eventProfile;
+    /** The event profiler, if enabled. */
+    std::unique_ptr<EventProfiler> m_profiler;
+    /** The TimerCoalescer, once used. */
+    std::unique_ptr<TimerCoalescer> m_timerCoalescer;
 };
 
 } // namespace ns3
@@ -7,6 +7,7 @@
  */
 #include "simulator.h"
 
+#include "abort.h"
 #include "assert.h"
 #include "des-metrics.h"
 #include "event-impl.h"
@@ -21,13 +22,24 @@
 
 #include "ns3/core-config.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <list>
+#include <thread>
 #include <vector>
 
+#ifndef __WIN32__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 /**
  * @file
  * @ingroup simulator
@@ -44,6 +56,9 @@ namespace ns3
 NS_LOG_COMPONENT_DEFINE("Simulator");
 
 EventId Simulator::m_stopEvent;
+bool Simulator::m_running = false;
+uint32_t Simulator::m_branch = Simulator::NO_BRANCH;
+uint32_t Simulator::m_failedBranches = 0;
 
 /**
  * @ingroup simulator
@@ -168,7 +183,9 @@ Simulator::Run()
 {
     NS_LOG_FUNCTION_NOARGS();
     Time::ClearMarkedTimes();
+    m_running = true;
     GetImpl()->Run();
+    m_running = false;
 }
 
 void
@@ -315,6 +332,106 @@ Simulator::GetEventCount()
     return GetImpl()->GetEventCount();
 }
 
+uint32_t
+Simulator::Branch(uint32_t branches)
+{
+    NS_LOG_FUNCTION(branches);
+    NS_ASSERT_MSG(branches > 0, "A simulation needs at least one branch");
+    NS_ABORT_MSG_UNLESS(m_running,
+                        "Simulator::Branch() called outside of Simulator::Run(), "
+                        "use Simulator::ScheduleBranch()");
+#ifdef __WIN32__
+    NS_FATAL_ERROR("Simulator::Branch() is not supported on Windows");
+    return NO_BRANCH;
+#else
+    // Otherwise, the output buffered so far would be written by every branch.
+    LogBufferFlush();
+    std::cout.flush();
+    std::cerr.flush();
+    std::clog.flush();
+    std::fflush(nullptr);
+
+    const uint32_t maxRunning = std::max(std::thread::hardware_concurrency(), 1U);
+    std::deque<pid_t> running;
+    m_failedBranches = 0;
+
+    auto waitOldest = [&running]() {
+        pid_t pid = running.front();
+        running.pop_front();
+        int status;
+        while (waitpid(pid, &status, 0) < 0)
+        {
+            if (errno != EINTR)
+            {
+                NS_FATAL_ERROR("Cannot wait for branch process " << pid << ": "
+                                                                 << std::strerror(errno));
+            }
+        }
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            NS_LOG_WARN("Branch process " << pid << " failed with status " << status);
+            m_failedBranches++;
+        }
+    };
+
+    for (uint32_t i = 0; i < branches; ++i)
+    {
+        if (running.size() >= maxRunning)
+        {
+            waitOldest();
+        }
+        // The messages logged since the last fork.
+        LogBufferFlush();
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            NS_FATAL_ERROR("Cannot fork branch " << i << ": " << std::strerror(errno));
+        }
+        if (pid == 0)
+        {
+            m_branch = i;
+            m_failedBranches = 0;
+            return i;
+        }
+        NS_LOG_LOGIC("branch " << i << " is process " << pid);
+        running.push_back(pid);
+    }
+    while (!running.empty())
+    {
+        waitOldest();
+    }
+    Stop();
+    return NO_BRANCH;
+#endif
+}
+
+EventId
+Simulator::ScheduleBranch(const Time& delay,
+                          uint32_t branches,
+                          const std::function<void(uint32_t)>& setup)
+{
+    NS_LOG_FUNCTION(delay << branches);
+    return Schedule(delay, [branches, setup]() {
+        uint32_t branch = Branch(branches);
+        if (branch != NO_BRANCH)
+        {
+            setup(branch);
+        }
+    });
+}
+
+uint32_t
+Simulator::GetBranch()
+{
+    return m_branch;
+}
+
+uint32_t
+Simulator::GetFailedBranchCount()
+{
+    return m_failedBranches;
+}
+
 uint32_t
 Simulator::GetSystemId()
 {
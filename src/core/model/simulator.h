@@ -9,12 +9,14 @@
 #ifndef SIMULATOR_H
 #define SIMULATOR_H
 
+#include "callback.h"
 #include "event-id.h"
 #include "event-impl.h"
 #include "make-event.h"
 #include "nstime.h"
 #include "object-factory.h"
 
+#include <functional>
 #include <stdint.h>
 #include <string>
 
@@ -205,6 +207,87 @@ class Simulator
      */
     static uint64_t GetEventCount();
 
+    /**
+     * @name Branch the simulation at a given time.
+     *
+     * Warm-started parameter sweeps run the same warm-up period once, then
+     * branch the simulation in several processes, each of them resuming
+     * from the state at the end of the warm-up with different parameters.
+     *
+     * The branches are forked processes: each of them starts with an exact
+     * copy of the event queue, of the objects and of the random variable
+     * stream states of the parent, without the need to serialize them.
+     * The branches run concurrently, at most one per hardware thread, and
+     * they must write their own output files.  The parent waits for all
+     * the branches, then stops the simulation.
+     *
+     * Branching is not supported on Windows.  The simulator implementation
+     * must not run other threads when the simulation branches:
+     * the RealtimeSimulatorImpl is not supported, and the
+     * MultithreadedSimulatorImpl only when it runs the events sequentially.
+     *
+     * Branches can branch again.
+     *
+     * @{
+     */
+    /**
+     * Value returned by Branch() and GetBranch() in the parent process.
+     */
+    enum : uint32_t
+    {
+        /**
+         * Flag for the parent process of the branches.
+         */
+        NO_BRANCH = 0xffffffff
+    };
+
+    /**
+     * Branch the simulation now.
+     *
+     * In the parent process, this returns once all the branches have
+     * exited, and stops the simulation.
+     *
+     * This must be called by an event, during Run(): Run() would resume
+     * the stopped simulation of the parent.  Use ScheduleBranch() to
+     * branch from the main program.
+     *
+     * @param [in] branches The number of branches.
+     * @returns The index of the branch in the branches, in [0, branches),
+     *          NO_BRANCH in the parent.
+     */
+    static uint32_t Branch(uint32_t branches);
+
+    /**
+     * Schedule the branching of the simulation.
+     *
+     * @param [in] delay The delay until the simulation branches.
+     * @param [in] branches The number of branches.
+     * @param [in] setup Called with the branch index in each branch, to
+     *             configure it before the simulation resumes.
+     * @returns The id of the branching event.
+     */
+    static EventId ScheduleBranch(const Time& delay,
+                                  uint32_t branches,
+                                  const std::function<void(uint32_t)>& setup);
+
+    /**
+     * Get the index of the current branch.
+     *
+     * @returns The index of the branch in its parent, NO_BRANCH if the
+     *          simulation did not branch.
+     */
+    static uint32_t GetBranch();
+
+    /**
+     * Get the number of branches which failed.
+     *
+     * @returns The number of branches of the last Branch() call which did
+     *          not exit with a zero status.
+     */
+    static uint32_t GetFailedBranchCount();
+
+    /** @} */
+
     /**
      * @name Schedule events (in the same context) to run at a future time.
      */
@@ -522,6 +605,13 @@ class Simulator
      */
     static EventId m_stopEvent;
 
+    /** Whether Run() is running. */
+    static bool m_running;
+    /** Index of the current branch. */
+    static uint32_t m_branch;
+    /** Number of branches of the last Branch() call which failed. */
+    static uint32_t m_failedBranches;
+
     // end of class Simulator
 };
 
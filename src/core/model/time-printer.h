@@ -14,12 +14,14 @@
  * @file
  * @ingroup time
  * Declaration of ns3::TimePrinter function pointer type
- * and ns3::DefaultTimePrinter function.
+ * and ns3::DefaultTimePrinter functions.
  */
 
 namespace ns3
 {
 
+class Time;
+
 /**
  * Function signature for features requiring a time formatter,
  * such as logging or ShowProgress.
@@ -38,6 +40,14 @@ typedef void (*TimePrinter)(std::ostream& os);
  */
 void DefaultTimePrinter(std::ostream& os);
 
+/**
+ * Print a simulation time in the format of DefaultTimePrinter().
+ *
+ * @param [in,out] os The output stream to print on.
+ * @param [in] time The simulation time.
+ */
+void PrintDefaultTime(std::ostream& os, const Time& time);
+
 } // namespace ns3
 
 #endif /* TIME_H */
@@ -280,11 +280,13 @@ Time::SetResolution(Unit unit, Resolution* resolution, const bool convert /* = t
     resolution->unit = unit;
 }
 
+#ifdef __WIN32__
 bool
 Time::MarkingTimes()
 {
     return (g_markingTimes != nullptr);
 }
+#endif
 
 // static
 void
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include "timer-coalescer.h"
+
+#include "assert.h"
+#include "global-value.h"
+#include "log.h"
+#include "simulator-impl.h"
+#include "simulator.h"
+
+/**
+ * @file
+ * @ingroup timer
+ * ns3::TimerCoalescer implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TimerCoalescer");
+
+/**
+ * @ingroup timer
+ * @anchor GlobalValueTimerCoalescingGranularity
+ * The granularity of the deadlines of the coalesced events.
+ */
+static GlobalValue g_timerCoalescingGranularity =
+    GlobalValue("TimerCoalescingGranularity",
+                "The deadlines of the events coalesced by TimerCoalescer are rounded "
+                "up to a multiple of this granularity",
+                TimeValue(Seconds(0)),
+                MakeTimeChecker(Seconds(0)));
+
+namespace
+{
+
+/** The bucket whose events are being invoked by this thread. */
+struct Expiring
+{
+    bool active{false};          //!< Whether a bucket is expiring.
+    uint64_t ts;                 //!< The deadline of the bucket.
+    uint32_t context;            //!< The context of the scheduler event.
+    uint32_t uid;                //!< The uid of the scheduler event.
+    EventImpl* current{nullptr}; //!< The event running.
+};
+
+/** The bucket whose events are being invoked by this thread. */
+thread_local Expiring t_expiring;
+
+} // namespace
+
+TimerCoalescer::TimerCoalescer(SimulatorImpl* impl)
+    : m_impl(impl),
+      m_allContexts(impl->CanInvokeWithContext()),
+      m_eventCount(0),
+      m_bucketCount(0)
+{
+    NS_LOG_FUNCTION(this << impl);
+    TimeValue granularity;
+    g_timerCoalescingGranularity.GetValue(granularity);
+    m_granularity = granularity.Get().GetTimeStep();
+}
+
+TimerCoalescer&
+TimerCoalescer::Get()
+{
+    return Simulator::GetImplementation()->GetTimerCoalescer();
+}
+
+std::unique_lock<std::mutex>
+TimerCoalescer::Lock()
+{
+    if (m_allContexts)
+    {
+        return std::unique_lock<std::mutex>(m_mutex, std::defer_lock);
+    }
+    return std::unique_lock<std::mutex>(m_mutex);
+}
+
+EventId
+TimerCoalescer::Schedule(const Time& delay, const Ptr<EventImpl>& event)
+{
+    return Get().DoSchedule(delay, event);
+}
+
+EventId
+TimerCoalescer::DoSchedule(const Time& delay, const Ptr<EventImpl>& event)
+{
+    NS_LOG_FUNCTION(this << delay << event);
+    NS_ASSERT_MSG(delay.IsPositive(), "TimerCoalescer::Schedule(): negative delay");
+    uint64_t now = Simulator::Now().GetTimeStep();
+    uint64_t ts = now + delay.GetTimeStep();
+    if (m_granularity > 0)
+    {
+        ts = (ts + m_granularity - 1) / m_granularity * m_granularity;
+    }
+    uint32_t context = Simulator::GetContext();
+    BucketKey key{ts, m_allContexts ? Simulator::NO_CONTEXT : context};
+
+    auto lock = Lock();
+    m_eventCount++;
+    auto [it, inserted] = m_buckets.try_emplace(key);
+    Bucket& bucket = it->second;
+    if (inserted)
+    {
+        NS_LOG_LOGIC("new bucket at " << ts);
+        bucket.event =
+            Simulator::Schedule(TimeStep(ts - now), &TimerCoalescer::Expire, this, ts, key.context);
+        m_bucketCount++;
+    }
+    bucket.subscribers.push_back({event, context});
+    return EventId(event, ts, bucket.event.GetContext(), bucket.event.GetUid());
+}
+
+void
+TimerCoalescer::Expire(uint64_t ts, uint32_t context)
+{
+    NS_LOG_FUNCTION(this << ts << context);
+    std::vector<Subscriber> subscribers;
+    {
+        auto lock = Lock();
+        auto it = m_buckets.find({ts, context});
+        NS_ASSERT(it != m_buckets.end());
+        subscribers = std::move(it->second.subscribers);
+        const EventId& event = it->second.event;
+        t_expiring = {true, event.GetTs(), event.GetContext(), event.GetUid(), nullptr};
+        m_buckets.erase(it);
+    }
+
+    for (const auto& subscriber : subscribers)
+    {
+        if (subscriber.event->IsCancelled())
+        {
+            continue;
+        }
+        t_expiring.current = PeekPointer(subscriber.event);
+        if (m_allContexts)
+        {
+            m_impl->InvokeWithContext(subscriber.context, PeekPointer(subscriber.event));
+        }
+        else
+        {
+            subscriber.event->Invoke();
+        }
+        // Mark the event as expired, for IsPending().
+        subscriber.event->Cancel();
+    }
+    t_expiring = {};
+}
+
+void
+TimerCoalescer::Cancel(const EventId& id)
+{
+    NS_LOG_FUNCTION(id.PeekEventImpl());
+    // Cancelling an expired event has no effect, as for EventId::Cancel().
+    if (id.PeekEventImpl() != nullptr)
+    {
+        id.PeekEventImpl()->Cancel();
+    }
+}
+
+bool
+TimerCoalescer::IsPending(const EventId& id)
+{
+    if (id.IsPending())
+    {
+        return true;
+    }
+    // The events of the expiring bucket which did not run yet.
+    return t_expiring.active && id.GetUid() == t_expiring.uid && id.GetTs() == t_expiring.ts &&
+           id.GetContext() == t_expiring.context && id.PeekEventImpl() != nullptr &&
+           id.PeekEventImpl() != t_expiring.current && !id.PeekEventImpl()->IsCancelled();
+}
+
+uint64_t
+TimerCoalescer::GetEventCount()
+{
+    TimerCoalescer& coalescer = Get();
+    auto lock = coalescer.Lock();
+    return coalescer.m_eventCount;
+}
+
+uint64_t
+TimerCoalescer::GetBucketCount()
+{
+    TimerCoalescer& coalescer = Get();
+    auto lock = coalescer.Lock();
+    return coalescer.m_bucketCount;
+}
+
+} // namespace ns3
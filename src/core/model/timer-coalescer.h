@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef TIMER_COALESCER_H
+#define TIMER_COALESCER_H
+
+#include "event-id.h"
+#include "event-impl.h"
+#include "make-event.h"
+#include "nstime.h"
+#include "ptr.h"
+
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup timer
+ * ns3::TimerCoalescer declaration.
+ */
+
+namespace ns3
+{
+
+class SimulatorImpl;
+
+/**
+ * @ingroup timer
+ * @brief Share the scheduler events of the timers expiring at the same time.
+ *
+ * Periodic timers, such as the hello timers of the routing protocols or
+ * the send timers of the traffic generators, schedule one event per period
+ * and per node.  The TimerCoalescer keeps a single scheduler event per
+ * deadline bucket instead, and fans it out to all the events of the bucket
+ * when it expires, so that the event list holds one event per distinct
+ * deadline rather than one per timer.  Only the timers which opt in are
+ * coalesced, with Timer::SetCoalescing(), Watchdog::SetCoalescing() or by
+ * scheduling their events with TimerCoalescer::Schedule(); the models
+ * using it do so when their \c TimerCoalescing attribute is \c true.
+ *
+ * The bucket of an event is its deadline, rounded up to a multiple of the
+ * \c TimerCoalescingGranularity global value.  With the default zero
+ * granularity, only the events expiring at the same time are coalesced,
+ * and they run at the time they would have run otherwise.  A larger
+ * granularity delays the events by up to the granularity, but coalesces
+ * more of them, including timers whose deadlines are jittered.
+ *
+ * The events of a bucket run in the order they were scheduled, each in
+ * its own context, when the first of them would have run.  They share the
+ * uid of the scheduler event of the bucket.  If the simulator
+ * implementation cannot invoke events of several contexts from a single
+ * event (see SimulatorImpl::CanInvokeWithContext()), the buckets are per
+ * context.
+ *
+ * Each simulator implementation has its own buckets, created with its
+ * first coalesced event.  The buckets are only locked if the simulator
+ * implementation cannot invoke events of several contexts, since it may
+ * then run the contexts concurrently.
+ *
+ * A coalesced event must be cancelled rather than removed, since it is not
+ * in the event list itself.  While its bucket expires, a coalesced event
+ * which did not run yet is reported as expired by EventId::IsExpired(), so
+ * the coalesced events should be checked and cancelled with IsPending()
+ * and Cancel(), which also work for the events scheduled as usual.
+ */
+class TimerCoalescer
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * This is called by SimulatorImpl::GetTimerCoalescer().
+     *
+     * @param [in] impl The simulator implementation.
+     */
+    TimerCoalescer(SimulatorImpl* impl);
+
+    /**
+     * Schedule a coalesced event to expire after @p delay.
+     *
+     * @param [in] delay The expiration delay.
+     * @param [in] event The event to invoke.
+     * @returns The id of the event.
+     */
+    static EventId Schedule(const Time& delay, const Ptr<EventImpl>& event);
+
+    /**
+     * Schedule a coalesced event to expire after @p delay.
+     *
+     * @tparam FUNC \deduced Template type for the function to invoke.
+     * @tparam Ts \deduced Argument types.
+     * @param [in] delay The expiration delay.
+     * @param [in] f The function to invoke.
+     * @param [in] args Arguments to pass to MakeEvent.
+     * @returns The id of the event.
+     */
+    template <typename FUNC,
+              std::enable_if_t<!std::is_convertible_v<FUNC, Ptr<EventImpl>>, int> = 0,
+              std::enable_if_t<!std::is_function_v<std::remove_pointer_t<FUNC>>, int> = 0,
+              typename... Ts>
+    static EventId Schedule(const Time& delay, FUNC f, Ts&&... args);
+
+    /**
+     * Schedule a coalesced event to expire after @p delay.
+     *
+     * @tparam Us \deduced Formal function argument types.
+     * @tparam Ts \deduced Actual function argument types.
+     * @param [in] delay The expiration delay.
+     * @param [in] f The function to invoke.
+     * @param [in] args Arguments to pass to the invoked function.
+     * @returns The id of the event.
+     */
+    template <typename... Us, typename... Ts>
+    static EventId Schedule(const Time& delay, void (*f)(Us...), Ts&&... args);
+
+    /**
+     * Cancel an event, coalesced or not.
+     *
+     * @param [in] id The event.
+     */
+    static void Cancel(const EventId& id);
+
+    /**
+     * Check if an event, coalesced or not, has yet to run.
+     *
+     * @param [in] id The event.
+     * @returns \c true if the event has not run and was not cancelled.
+     */
+    static bool IsPending(const EventId& id);
+
+    /**
+     * Get the number of events scheduled with Schedule() in the current
+     * simulation.
+     *
+     * @returns The number of events.
+     */
+    static uint64_t GetEventCount();
+
+    /**
+     * Get the number of events put in the event list for them, one per
+     * bucket, in the current simulation.
+     *
+     * @returns The number of scheduler events.
+     */
+    static uint64_t GetBucketCount();
+
+  private:
+    /** A coalesced event. */
+    struct Subscriber
+    {
+        Ptr<EventImpl> event; //!< The event.
+        uint32_t context;     //!< The context it was scheduled from.
+    };
+
+    /** The events coalesced in a scheduler event. */
+    struct Bucket
+    {
+        EventId event;                       //!< The scheduler event.
+        std::vector<Subscriber> subscribers; //!< The coalesced events, in schedule order.
+    };
+
+    /** The key of a bucket: its deadline and context. */
+    struct BucketKey
+    {
+        uint64_t ts;      //!< The deadline.
+        uint32_t context; //!< The context, or Simulator::NO_CONTEXT for all contexts.
+
+        /**
+         * Equality operator.
+         * @param [in] other The other key.
+         * @returns \c true if the keys are equal.
+         */
+        bool operator==(const BucketKey& other) const = default;
+    };
+
+    /** Hash function for BucketKey. */
+    struct BucketKeyHash
+    {
+        /**
+         * Hash a key.
+         * @param [in] key The key.
+         * @returns The hash.
+         */
+        std::size_t operator()(const BucketKey& key) const
+        {
+            return std::hash<uint64_t>()(key.ts ^ (uint64_t(key.context) << 32));
+        }
+    };
+
+    /**
+     * Get the TimerCoalescer of the current simulator implementation.
+     * @returns The TimerCoalescer.
+     */
+    static TimerCoalescer& Get();
+
+    /**
+     * Lock the buckets, if the contexts may run concurrently.
+     * @returns The lock, which does not own the mutex otherwise.
+     */
+    std::unique_lock<std::mutex> Lock();
+
+    /**
+     * Schedule a coalesced event.
+     * @param [in] delay The expiration delay.
+     * @param [in] event The event to invoke.
+     * @returns The id of the event.
+     */
+    EventId DoSchedule(const Time& delay, const Ptr<EventImpl>& event);
+
+    /**
+     * Invoke the events of a bucket.
+     * @param [in] ts The deadline of the bucket.
+     * @param [in] context The context of the bucket.
+     */
+    void Expire(uint64_t ts, uint32_t context);
+
+    SimulatorImpl* m_impl;  //!< The simulator implementation.
+    bool m_allContexts;     //!< Whether the buckets are shared by all the contexts.
+    uint64_t m_granularity; //!< The granularity of the deadlines, in time steps.
+    std::mutex m_mutex;     //!< Protects the buckets, unless m_allContexts.
+    /** The pending buckets. */
+    std::unordered_map<BucketKey, Bucket, BucketKeyHash> m_buckets;
+    uint64_t m_eventCount;  //!< The number of events scheduled.
+    uint64_t m_bucketCount; //!< The number of scheduler events.
+};
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+template <typename FUNC,
+          std::enable_if_t<!std::is_convertible_v<FUNC, Ptr<EventImpl>>, int>,
+          std::enable_if_t<!std::is_function_v<std::remove_pointer_t<FUNC>>, int>,
+          typename... Ts>
+EventId
+TimerCoalescer::Schedule(const Time& delay, FUNC f, Ts&&... args)
+{
+    return Schedule(delay, Ptr<EventImpl>(MakeEvent(f, std::forward<Ts>(args)...), false));
+}
+
+template <typename... Us, typename... Ts>
+EventId
+TimerCoalescer::Schedule(const Time& delay, void (*f)(Us...), Ts&&... args)
+{
+    return Schedule(delay, Ptr<EventImpl>(MakeEvent(f, std::forward<Ts>(args)...), false));
+}
+
+} // namespace ns3
+
+#endif /* TIMER_COALESCER_H */
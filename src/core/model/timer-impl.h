@@ -55,6 +55,12 @@ class TimerImpl
      * @returns The scheduled EventId.
      */
     virtual EventId Schedule(const Time& delay) = 0;
+    /**
+     * Make an event invoking the expire function with the current arguments.
+     *
+     * @returns The event.
+     */
+    virtual EventImpl* MakeEvent() = 0;
     /** Invoke the expire function. */
     virtual void Invoke() = 0;
 };
@@ -110,6 +116,15 @@ MakeTimerImpl(U(fn)(Ts...))
                 m_arguments);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return std::apply(
+                [this](Ts... args) {
+                    return ns3::MakeEvent([fn = m_fn, args...]() mutable { (fn)(args...); });
+                },
+                m_arguments);
+        }
+
         void Invoke() override
         {
             std::apply([this](Ts... args) { (m_fn)(args...); }, m_arguments);
@@ -159,6 +174,13 @@ MakeTimerImpl(U (V::*memPtr)(Ts...), OBJ_PTR objPtr)
                 m_arguments);
         }
 
+        EventImpl* MakeEvent() override
+        {
+            return std::apply(
+                [this](Ts... args) { return ns3::MakeEvent(std::bind(m_memPtr, args...)); },
+                m_arguments);
+        }
+
         void Invoke() override
         {
             std::apply(m_memPtr, m_arguments);
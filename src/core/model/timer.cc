@@ -10,6 +10,7 @@
 #include "log.h"
 #include "simulation-singleton.h"
 #include "simulator.h"
+#include "timer-coalescer.h"
 
 /**
  * @file
@@ -45,18 +46,18 @@ Timer::~Timer()
     NS_LOG_FUNCTION(this);
     if (m_flags & CHECK_ON_DESTROY)
     {
-        if (m_event.IsPending())
+        if (IsEventPending())
         {
             NS_FATAL_ERROR("Event is still running while destroying.");
         }
     }
     else if (m_flags & CANCEL_ON_DESTROY)
     {
-        m_event.Cancel();
+        CancelEvent(false);
     }
     else if (m_flags & REMOVE_ON_DESTROY)
     {
-        m_event.Remove();
+        CancelEvent(true);
     }
     delete m_impl;
 }
@@ -97,28 +98,28 @@ void
 Timer::Cancel()
 {
     NS_LOG_FUNCTION(this);
-    m_event.Cancel();
+    CancelEvent(false);
 }
 
 void
 Timer::Remove()
 {
     NS_LOG_FUNCTION(this);
-    m_event.Remove();
+    CancelEvent(true);
 }
 
 bool
 Timer::IsExpired() const
 {
     NS_LOG_FUNCTION(this);
-    return !IsSuspended() && m_event.IsExpired();
+    return !IsSuspended() && !IsEventPending();
 }
 
 bool
 Timer::IsRunning() const
 {
     NS_LOG_FUNCTION(this);
-    return !IsSuspended() && m_event.IsPending();
+    return !IsSuspended() && IsEventPending();
 }
 
 bool
@@ -159,11 +160,26 @@ Timer::Schedule(Time delay)
 {
     NS_LOG_FUNCTION(this << delay);
     NS_ASSERT(m_impl != nullptr);
-    if (m_event.IsPending())
+    if (IsEventPending())
     {
         NS_FATAL_ERROR("Event is still running while re-scheduling.");
     }
-    m_event = m_impl->Schedule(delay);
+    ScheduleEvent(delay);
+}
+
+void
+Timer::SetCoalescing(bool coalescing)
+{
+    NS_LOG_FUNCTION(this << coalescing);
+    NS_ASSERT_MSG(!IsEventPending(), "Cannot change the coalescing of a running timer");
+    if (coalescing)
+    {
+        m_flags |= TIMER_COALESCED;
+    }
+    else
+    {
+        m_flags &= ~TIMER_COALESCED;
+    }
 }
 
 void
@@ -174,11 +190,11 @@ Timer::Suspend()
     m_delayLeft = Simulator::GetDelayLeft(m_event);
     if (m_flags & CANCEL_ON_DESTROY)
     {
-        m_event.Cancel();
+        CancelEvent(false);
     }
     else if (m_flags & REMOVE_ON_DESTROY)
     {
-        m_event.Remove();
+        CancelEvent(true);
     }
     m_flags |= TIMER_SUSPENDED;
 }
@@ -188,8 +204,49 @@ Timer::Resume()
 {
     NS_LOG_FUNCTION(this);
     NS_ASSERT(m_flags & TIMER_SUSPENDED);
-    m_event = m_impl->Schedule(m_delayLeft);
+    ScheduleEvent(m_delayLeft);
     m_flags &= ~TIMER_SUSPENDED;
 }
 
+bool
+Timer::IsEventPending() const
+{
+    if (m_flags & TIMER_COALESCED)
+    {
+        return TimerCoalescer::IsPending(m_event);
+    }
+    return m_event.IsPending();
+}
+
+void
+Timer::CancelEvent(bool remove)
+{
+    if (m_flags & TIMER_COALESCED)
+    {
+        // The coalesced events are not in the event list.
+        TimerCoalescer::Cancel(m_event);
+    }
+    else if (remove)
+    {
+        m_event.Remove();
+    }
+    else
+    {
+        m_event.Cancel();
+    }
+}
+
+void
+Timer::ScheduleEvent(const Time& delay)
+{
+    if (m_flags & TIMER_COALESCED)
+    {
+        m_event = TimerCoalescer::Schedule(delay, Ptr<EventImpl>(m_impl->MakeEvent(), false));
+    }
+    else
+    {
+        m_event = m_impl->Schedule(delay);
+    }
+}
+
 } // namespace ns3
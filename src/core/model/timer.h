@@ -205,6 +205,17 @@ class Timer
      */
     void Schedule(Time delay);
 
+    /**
+     * Share the scheduler events of this timer with the other coalesced
+     * timers expiring at the same time, as described in TimerCoalescer.
+     *
+     * With coalescing, Remove() and the \c REMOVE_ON_DESTROY policy cancel
+     * the event instead.  It applies from the next call to Schedule().
+     *
+     * @param [in] coalescing Whether to coalesce the events of this timer.
+     */
+    void SetCoalescing(bool coalescing);
+
     /**
      * Pause the timer and save the amount of time left until it was
      * set to expire.
@@ -226,14 +237,32 @@ class Timer
     void Resume();
 
   private:
+    /** Internal bit marking the coalesced timers */
+    static constexpr auto TIMER_COALESCED{1 << 6};
     /** Internal bit marking the suspended timer state */
     static constexpr auto TIMER_SUSPENDED{1 << 7};
 
     /**
-     * Bitfield for Timer State, DestroyPolicy and InternalSuspended.
+     * Check if the event of the timer has yet to run.
+     * @returns \c true if the event is pending.
+     */
+    bool IsEventPending() const;
+    /**
+     * Cancel the event of the timer, or remove it from the event list.
+     * @param [in] remove Whether to remove the event, if it is not coalesced.
+     */
+    void CancelEvent(bool remove);
+    /**
+     * Schedule the event of the timer.
+     * @param [in] delay The delay.
+     */
+    void ScheduleEvent(const Time& delay);
+
+    /**
+     * Bitfield for Timer State, DestroyPolicy, InternalCoalesced and InternalSuspended.
      *
      * @internal
-     * The DestroyPolicy, State and InternalSuspended state are stored
+     * The DestroyPolicy, State, InternalCoalesced and InternalSuspended bits are stored
      * in this single bitfield.  The State uses the low-order bits,
      * so the other users of the bitfield have to be careful in defining
      * their bits to avoid the State.
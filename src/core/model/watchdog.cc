@@ -8,6 +8,7 @@
 #include "watchdog.h"
 
 #include "log.h"
+#include "timer-coalescer.h"
 
 /**
  * @file
@@ -23,7 +24,8 @@ NS_LOG_COMPONENT_DEFINE("Watchdog");
 Watchdog::Watchdog()
     : m_impl(nullptr),
       m_event(),
-      m_end()
+      m_end(),
+      m_coalescing(false)
 {
     NS_LOG_FUNCTION_NOARGS();
 }
@@ -31,7 +33,7 @@ Watchdog::Watchdog()
 Watchdog::~Watchdog()
 {
     NS_LOG_FUNCTION(this);
-    m_event.Cancel();
+    TimerCoalescer::Cancel(m_event);
     delete m_impl;
 }
 
@@ -41,11 +43,18 @@ Watchdog::Ping(Time delay)
     NS_LOG_FUNCTION(this << delay);
     Time end = Simulator::Now() + delay;
     m_end = std::max(m_end, end);
-    if (m_event.IsPending())
+    if (TimerCoalescer::IsPending(m_event))
     {
         return;
     }
-    m_event = Simulator::Schedule(m_end - Now(), &Watchdog::Expire, this);
+    ScheduleExpire();
+}
+
+void
+Watchdog::SetCoalescing(bool coalescing)
+{
+    NS_LOG_FUNCTION(this << coalescing);
+    m_coalescing = coalescing;
 }
 
 void
@@ -57,6 +66,19 @@ Watchdog::Expire()
         m_impl->Invoke();
     }
     else
+    {
+        ScheduleExpire();
+    }
+}
+
+void
+Watchdog::ScheduleExpire()
+{
+    if (m_coalescing)
+    {
+        m_event = TimerCoalescer::Schedule(m_end - Now(), &Watchdog::Expire, this);
+    }
+    else
     {
         m_event = Simulator::Schedule(m_end - Now(), &Watchdog::Expire, this);
     }
@@ -66,6 +66,16 @@ class Watchdog
      */
     void Ping(Time delay);
 
+    /**
+     * Share the scheduler events of this watchdog with the other coalesced
+     * timers expiring at the same time, as described in TimerCoalescer.
+     *
+     * It applies from the next event scheduled by the watchdog.
+     *
+     * @param [in] coalescing Whether to coalesce the events of this watchdog.
+     */
+    void SetCoalescing(bool coalescing);
+
     /**
      * Set the function to execute when the timer expires.
      *
@@ -105,6 +115,8 @@ class Watchdog
   private:
     /** Internal callback invoked when the timer expires. */
     void Expire();
+    /** Schedule the event expiring the timer at #m_end. */
+    void ScheduleExpire();
     /**
      * The timer implementation, which contains the bound callback
      * function and arguments.
@@ -114,6 +126,8 @@ class Watchdog
     EventId m_event;
     /** The absolute time when the timer will expire. */
     Time m_end;
+    /** Whether the events are coalesced. */
+    bool m_coalescing;
 };
 
 } // namespace ns3
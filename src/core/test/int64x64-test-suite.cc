@@ -582,6 +582,13 @@ Int64x64ArithmeticTestCase::DoRun()
         Check(54, ret, expected, tolerance);
     }
 
+    // Multiplication and division by an integer, the fast paths of int64x64-128.h
+    Check(55, onef * int64x64_t(-3), -int64x64_t(5, 0x4000000000000000ULL));
+    Check(56, int64x64_t(-4) * (-twof), int64x64_t(11, 0));
+    Check(57, (-onef) / two, -int64x64_t(0, 0xe000000000000000ULL));
+    Check(58, one / three, int64x64_t(0, 0x5555555555555555ULL));
+    Check(59, (-one) / int64x64_t(1000000000), -int64x64_t(0, 0x44b82fa09ULL));
+
     // The following triggers an assert in int64x64-128.cc:Umul():117
     /*
     {
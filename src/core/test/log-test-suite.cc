@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/log.h"
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup logging-tests
+ * Logging test suite
+ */
+
+/**
+ * @ingroup core-tests
+ * @ingroup logging
+ * @defgroup logging-tests Logging test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+NS_LOG_COMPONENT_DEFINE("LogTestSuite");
+
+/**
+ * @ingroup logging-tests
+ * A type whose output operator takes a non-const reference.
+ */
+struct NonConstPrintable
+{
+    double value; //!< The value printed.
+};
+
+/**
+ * Output operator taking a non-const reference.
+ * @param [in,out] os The output stream.
+ * @param [in] printable The value.
+ * @returns The output stream.
+ */
+std::ostream&
+operator<<(std::ostream& os, NonConstPrintable& printable)
+{
+    return os << "printable " << printable.value;
+}
+
+/**
+ * @ingroup logging-tests
+ * Log messages of all the kinds supported by the log buffer.
+ * @param [in] object An object.
+ */
+static void
+LogMessages(Ptr<Object> object)
+{
+    NS_LOG_FUNCTION_NOARGS();
+    std::vector<uint32_t> values{1, 2, 3};
+    std::string name = "name";
+    NS_LOG_FUNCTION(name << 42 << uint8_t(7) << true << Seconds(2) << values);
+    NS_LOG_INFO("literal " << name << " " << 1.5 << " " << int8_t(65) << " " << false);
+    NS_LOG_DEBUG("time " << MilliSeconds(-3) << " now " << Simulator::Now());
+    NS_LOG_LOGIC(std::hex << 255 << " " << std::setw(6) << 10 << std::dec << " " << 255);
+    NS_LOG_WARN("object " << object << " char* " << static_cast<const char*>("text"));
+    NS_LOG_ERROR("multi" << std::endl << "line");
+    NonConstPrintable printable{1.0 / 3};
+    NS_LOG_INFO(printable);
+    // The arguments formatted when logged follow the recorded manipulators.
+    NS_LOG_INFO(std::fixed << std::setprecision(3) << printable << " " << 2.5 << std::defaultfloat
+                           << std::setprecision(6) << " " << printable);
+}
+
+/**
+ * @ingroup logging-tests
+ *
+ * @brief Check that the log buffer formats the messages as when they
+ * are written directly, and only when it is flushed.
+ */
+class LogBufferTestCase : public TestCase
+{
+  public:
+    LogBufferTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Log the messages in an event, with the time and node prefixes.
+     * @param [in] flush Whether to flush the log buffer after the messages.
+     * @returns The output.
+     */
+    std::string Run(bool flush);
+
+    Ptr<Object> m_object; //!< The object logged.
+};
+
+LogBufferTestCase::LogBufferTestCase()
+    : TestCase("Check the log buffer")
+{
+}
+
+std::string
+LogBufferTestCase::Run(bool flush)
+{
+    std::ostringstream os;
+    std::streambuf* clog = std::clog.rdbuf(os.rdbuf());
+    Simulator::ScheduleWithContext(3, Seconds(1.5), &LogMessages, m_object);
+    Simulator::Schedule(Seconds(2), &LogMessages, m_object);
+    Simulator::Run();
+    if (flush)
+    {
+        LogBufferFlush();
+    }
+    std::clog.rdbuf(clog);
+    Simulator::Destroy();
+    return os.str();
+}
+
+void
+LogBufferTestCase::DoRun()
+{
+    LogComponentEnable("LogTestSuite", LOG_LEVEL_ALL);
+    LogComponentEnable("LogTestSuite", LOG_PREFIX_ALL);
+    m_object = CreateObject<UniformRandomVariable>();
+
+    std::string expected = Run(false);
+    NS_TEST_ASSERT_MSG_NE(expected, "", "No log message");
+
+    // Small enough to be flushed and to grow.
+    LogBufferEnable(64);
+    std::string buffered = Run(true);
+    NS_TEST_EXPECT_MSG_EQ(buffered, expected, "Wrong buffered messages");
+
+    LogBufferEnable(1 << 20);
+    std::string unflushed = Run(false);
+    NS_TEST_EXPECT_MSG_EQ(unflushed, "", "Messages written before the flush");
+    std::ostringstream os;
+    std::streambuf* clog = std::clog.rdbuf(os.rdbuf());
+    LogBufferDisable();
+    std::clog.rdbuf(clog);
+    NS_TEST_EXPECT_MSG_EQ(os.str(), expected, "Wrong messages flushed by LogBufferDisable()");
+
+    LogComponentDisable("LogTestSuite", LOG_ALL);
+    LogComponentDisable("LogTestSuite", LOG_PREFIX_ALL);
+    m_object = nullptr;
+}
+
+#undef NS_LOG_STATIC_LEVEL
+#define NS_LOG_STATIC_LEVEL ns3::LOG_LEVEL_INFO
+
+/**
+ * @ingroup logging-tests
+ * Log a message at each level, with NS_LOG_STATIC_LEVEL set to LOG_LEVEL_INFO.
+ * @param [in,out] count The number of messages whose arguments were evaluated.
+ */
+static void
+LogLevels(uint32_t& count)
+{
+    NS_LOG_FUNCTION(++count);
+    NS_LOG_ERROR(++count);
+    NS_LOG_WARN(++count);
+    NS_LOG_INFO(++count);
+    NS_LOG_LOGIC(++count);
+    NS_LOG_DEBUG(++count);
+}
+
+#undef NS_LOG_STATIC_LEVEL
+#define NS_LOG_STATIC_LEVEL ns3::LOG_LEVEL_ALL
+
+/**
+ * @ingroup logging-tests
+ *
+ * @brief Check that the levels above NS_LOG_STATIC_LEVEL are compiled out.
+ */
+class LogStaticLevelTestCase : public TestCase
+{
+  public:
+    LogStaticLevelTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LogStaticLevelTestCase::LogStaticLevelTestCase()
+    : TestCase("Check the compile-time log level")
+{
+}
+
+void
+LogStaticLevelTestCase::DoRun()
+{
+    LogComponentEnable("LogTestSuite", LOG_LEVEL_ALL);
+    std::ostringstream os;
+    std::streambuf* clog = std::clog.rdbuf(os.rdbuf());
+    uint32_t count = 0;
+    LogLevels(count);
+    std::clog.rdbuf(clog);
+    LogComponentDisable("LogTestSuite", LOG_ALL);
+
+    NS_TEST_EXPECT_MSG_EQ(count, 3, "Wrong number of messages evaluated");
+    NS_TEST_EXPECT_MSG_EQ(os.str(), "1\n2\n3\n", "Wrong messages");
+}
+
+/**
+ * @ingroup logging-tests
+ *
+ * @brief The Logging Test Suite.
+ */
+class LogTestSuite : public TestSuite
+{
+  public:
+    LogTestSuite()
+        : TestSuite("log")
+    {
+#ifdef NS3_LOG_ENABLE
+        AddTestCase(new LogBufferTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new LogStaticLevelTestCase(), TestCase::Duration::QUICK);
+#endif
+    }
+};
+
+/// Static variable for test initialization.
+static LogTestSuite g_logTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/nstime.h"
+#include "ns3/object-factory.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @file
+ * @ingroup multithreaded-simulator-tests
+ * MultithreadedSimulatorImpl test suite
+ */
+
+/**
+ * @ingroup core-tests
+ * @defgroup multithreaded-simulator-tests MultithreadedSimulatorImpl tests
+ */
+
+/**
+ * @ingroup multithreaded-simulator-tests
+ *
+ * @brief Check that a ring of contexts exchanging messages produces the
+ * same trace as the DefaultSimulatorImpl, whatever the number of threads.
+ */
+class MultithreadedSimulatorRingTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * @param lookAhead The lookahead of the simulator.
+     * @param threads The maximum number of threads.
+     */
+    MultithreadedSimulatorRingTestCase(Time lookAhead, uint32_t threads);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the ring scenario.
+     * @param impl The simulator implementation.
+     * @return The per-context trace of (time, hop) pairs.
+     */
+    std::vector<std::vector<std::pair<int64_t, uint32_t>>> RunRing(Ptr<SimulatorImpl> impl);
+
+    /**
+     * Receive a message on a context and forward it to the next one.
+     * @param hop The number of hops done so far.
+     */
+    void Receive(uint32_t hop);
+
+    /**
+     * Local timer event, scheduled without context.
+     * @param hop The hop which armed the timer.
+     */
+    void Timer(uint32_t hop);
+
+    Time m_lookAhead;   //!< Lookahead of the simulator.
+    uint32_t m_threads; //!< Maximum number of threads.
+    /// Trace of each context.
+    std::vector<std::vector<std::pair<int64_t, uint32_t>>> m_trace;
+    std::vector<bool> m_contextError; //!< Context mismatch, per context.
+};
+
+/// Number of contexts in the ring.
+static constexpr uint32_t RING_SIZE = 16;
+/// Channel delay between two contexts of the ring.
+static const Time RING_DELAY = MicroSeconds(10);
+
+MultithreadedSimulatorRingTestCase::MultithreadedSimulatorRingTestCase(Time lookAhead,
+                                                                       uint32_t threads)
+    : TestCase("Check a ring of contexts with lookahead " +
+               std::to_string(lookAhead.GetNanoSeconds()) + " ns and " + std::to_string(threads) +
+               " threads"),
+      m_lookAhead(lookAhead),
+      m_threads(threads)
+{
+}
+
+void
+MultithreadedSimulatorRingTestCase::Receive(uint32_t hop)
+{
+    uint32_t context = Simulator::GetContext();
+    m_trace[context].emplace_back(Simulator::Now().GetNanoSeconds(), hop);
+    if (hop >= 200)
+    {
+        return;
+    }
+    Simulator::Schedule(NanoSeconds(500 + 100 * (hop % 7)),
+                        &MultithreadedSimulatorRingTestCase::Timer,
+                        this,
+                        hop);
+    Simulator::ScheduleWithContext((context + 1) % RING_SIZE,
+                                   RING_DELAY + NanoSeconds(hop % 3),
+                                   &MultithreadedSimulatorRingTestCase::Receive,
+                                   this,
+                                   hop + 1);
+}
+
+void
+MultithreadedSimulatorRingTestCase::Timer(uint32_t hop)
+{
+    uint32_t context = Simulator::GetContext();
+    if (context >= RING_SIZE)
+    {
+        m_contextError.assign(RING_SIZE, true);
+        return;
+    }
+    m_trace[context].emplace_back(Simulator::Now().GetNanoSeconds(), hop + 1000);
+}
+
+std::vector<std::vector<std::pair<int64_t, uint32_t>>>
+MultithreadedSimulatorRingTestCase::RunRing(Ptr<SimulatorImpl> impl)
+{
+    m_trace.assign(RING_SIZE, {});
+    m_contextError.assign(RING_SIZE, false);
+    Simulator::SetImplementation(impl);
+    for (uint32_t i = 0; i < RING_SIZE; i += 4)
+    {
+        Simulator::ScheduleWithContext(i,
+                                       MicroSeconds(i),
+                                       &MultithreadedSimulatorRingTestCase::Receive,
+                                       this,
+                                       0);
+    }
+    Simulator::Run();
+    Simulator::Destroy();
+    return m_trace;
+}
+
+void
+MultithreadedSimulatorRingTestCase::DoRun()
+{
+    ObjectFactory factory;
+    factory.SetTypeId("ns3::DefaultSimulatorImpl");
+    auto expected = RunRing(factory.Create<SimulatorImpl>());
+
+    factory.SetTypeId(MultithreadedSimulatorImpl::GetTypeId());
+    factory.Set("LookAhead", TimeValue(m_lookAhead));
+    factory.Set("MaxThreads", UintegerValue(m_threads));
+    auto impl = factory.Create<MultithreadedSimulatorImpl>();
+    auto actual = RunRing(impl);
+
+    for (uint32_t i = 0; i < RING_SIZE; ++i)
+    {
+        // Only the time and hop of the events matter, not the order of
+        // events of a context falling on the same timestamp.
+        std::sort(expected[i].begin(), expected[i].end());
+        std::sort(actual[i].begin(), actual[i].end());
+        NS_TEST_EXPECT_MSG_EQ(m_contextError[i], false, "Event ran in the wrong context");
+        NS_TEST_EXPECT_MSG_GT(expected[i].size(), 0, "No event on context " << i);
+        NS_TEST_EXPECT_MSG_EQ(actual[i].size(), expected[i].size(), "Wrong event count");
+        NS_TEST_EXPECT_MSG_EQ((actual[i] == expected[i]), true, "Trace mismatch on context " << i);
+    }
+}
+
+/**
+ * @ingroup multithreaded-simulator-tests
+ *
+ * @brief Check the events run in the NO_CONTEXT context, Stop and Cancel.
+ */
+class MultithreadedSimulatorControlTestCase : public TestCase
+{
+  public:
+    MultithreadedSimulatorControlTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** Periodic event of a context. */
+    void Tick();
+    /** Event which must never run. */
+    void Cancelled();
+
+    uint32_t m_ticks;    //!< Number of ticks.
+    bool m_cancelledRan; //!< Whether the cancelled event ran.
+};
+
+MultithreadedSimulatorControlTestCase::MultithreadedSimulatorControlTestCase()
+    : TestCase("Check Stop and Cancel with the MultithreadedSimulatorImpl")
+{
+}
+
+void
+MultithreadedSimulatorControlTestCase::Tick()
+{
+    if (Simulator::GetContext() == 1)
+    {
+        m_ticks++;
+    }
+    Simulator::Schedule(MilliSeconds(1), &MultithreadedSimulatorControlTestCase::Tick, this);
+}
+
+void
+MultithreadedSimulatorControlTestCase::Cancelled()
+{
+    m_cancelledRan = true;
+}
+
+void
+MultithreadedSimulatorControlTestCase::DoRun()
+{
+    m_ticks = 0;
+    m_cancelledRan = false;
+
+    ObjectFactory factory;
+    factory.SetTypeId(MultithreadedSimulatorImpl::GetTypeId());
+    factory.Set("MaxThreads", UintegerValue(2));
+    auto impl = factory.Create<MultithreadedSimulatorImpl>();
+    impl->BoundLookAhead(MilliSeconds(1));
+    impl->BoundLookAhead(MicroSeconds(100));
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(), MicroSeconds(100), "Lookahead not bounded");
+    auto sequential = factory.Create<MultithreadedSimulatorImpl>();
+    sequential->BoundLookAhead(Seconds(0));
+    sequential->BoundLookAhead(MilliSeconds(1));
+    NS_TEST_EXPECT_MSG_EQ(sequential->GetLookAhead(), Seconds(0), "Zero bound not kept");
+    Simulator::SetImplementation(impl);
+
+    Simulator::ScheduleWithContext(1,
+                                   Seconds(0),
+                                   &MultithreadedSimulatorControlTestCase::Tick,
+                                   this);
+    Simulator::ScheduleWithContext(2,
+                                   Seconds(0),
+                                   &MultithreadedSimulatorControlTestCase::Tick,
+                                   this);
+    EventId cancelled = Simulator::Schedule(MilliSeconds(5),
+                                            &MultithreadedSimulatorControlTestCase::Cancelled,
+                                            this);
+    Simulator::Cancel(cancelled);
+    Simulator::Stop(MilliSeconds(10) + NanoSeconds(1));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_ticks, 11, "Wrong number of ticks before Stop");
+    NS_TEST_EXPECT_MSG_EQ(m_cancelledRan, false, "Cancelled event ran");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcessCount(), 3, "Wrong number of logical processes");
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), MilliSeconds(10) + NanoSeconds(1), "Wrong stop time");
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup multithreaded-simulator-tests
+ *
+ * @brief The MultithreadedSimulatorImpl Test Suite.
+ */
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+  public:
+    MultithreadedSimulatorTestSuite()
+        : TestSuite("multithreaded-simulator")
+    {
+        AddTestCase(new MultithreadedSimulatorRingTestCase(Seconds(0), 1),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new MultithreadedSimulatorRingTestCase(MicroSeconds(10), 1),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new MultithreadedSimulatorRingTestCase(MicroSeconds(10), 4),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new MultithreadedSimulatorRingTestCase(MicroSeconds(5), 8),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new MultithreadedSimulatorControlTestCase(), TestCase::Duration::QUICK);
+    }
+};
+
+/// Static variable for test initialization.
+static MultithreadedSimulatorTestSuite g_multithreadedSimulatorTestSuite;
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/config.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/replication-runner.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+
+#include <cstdlib>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * @file
+ * @ingroup core-helpers-tests
+ * ReplicationRunner test suite
+ */
+
+/**
+ * @ingroup core-tests
+ * @defgroup core-helpers-tests Core helpers tests
+ */
+
+/**
+ * @ingroup core-helpers-tests
+ *
+ * @brief Check that the replications run with their parameters and RngRun,
+ * and that their results are merged in grid order.
+ */
+class ReplicationRunnerTestCase : public TestCase
+{
+  public:
+    ReplicationRunnerTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * The scenario: sum random values drawn by events.
+     * @param parameters The parameters of the replication.
+     * @param results The results of the replication.
+     */
+    static void Scenario(const ReplicationRunner::Parameters& parameters,
+                         ReplicationRunner::Results& results);
+};
+
+ReplicationRunnerTestCase::ReplicationRunnerTestCase()
+    : TestCase("Check the replications and their merged results")
+{
+}
+
+void
+ReplicationRunnerTestCase::Scenario(const ReplicationRunner::Parameters& parameters,
+                                    ReplicationRunner::Results& results)
+{
+    double scale = std::stod(parameters.at("scale"));
+    if (scale < 0)
+    {
+        std::_Exit(3);
+    }
+    Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable>();
+    random->SetStream(1);
+    double sum = 0;
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        Simulator::Schedule(Seconds(random->GetValue()), [&sum, scale, random]() {
+            sum += random->GetValue() * scale;
+        });
+    }
+    Simulator::Run();
+    results.push_back(
+        {{"sum", std::to_string(sum)}, {"time", std::to_string(Now().GetSeconds())}});
+    results.push_back({{"note", "a,b=\"c\"\td\n"}});
+}
+
+void
+ReplicationRunnerTestCase::DoRun()
+{
+    const std::vector<std::string> maxValues{"10", "20"};
+    const std::vector<std::string> scales{"1", "2"};
+    const uint32_t runs = 3;
+
+    // Expected results, computed in this process.
+    std::vector<ReplicationRunner::Results> expected;
+    uint64_t savedRun = RngSeedManager::GetRun();
+    for (const auto& max : maxValues)
+    {
+        for (const auto& scale : scales)
+        {
+            for (uint32_t run = 5; run < 5 + runs; ++run)
+            {
+                RngSeedManager::SetRun(run);
+                Config::SetDefault("ns3::UniformRandomVariable::Max", StringValue(max));
+                ReplicationRunner::Results results;
+                Scenario({{"ns3::UniformRandomVariable::Max", max}, {"scale", scale}}, results);
+                Simulator::Destroy();
+                expected.push_back(results);
+            }
+        }
+    }
+    Config::Reset();
+    RngSeedManager::SetRun(savedRun);
+
+    ReplicationRunner runner;
+    runner.AddParameter("ns3::UniformRandomVariable::Max", maxValues);
+    runner.AddParameter("scale", scales);
+    runner.SetRuns(runs, 5);
+    runner.SetMaxWorkers(2);
+    runner.SetScenario(&ReplicationRunnerTestCase::Scenario);
+    runner.Run();
+
+    NS_TEST_EXPECT_MSG_EQ(runner.GetFailedCount(), 0, "A replication failed");
+    const auto& results = runner.GetResults();
+    NS_TEST_ASSERT_MSG_EQ(results.size(), 2 * expected.size(), "Wrong number of result rows");
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        const auto& row = results[2 * i];
+        NS_TEST_ASSERT_MSG_EQ(row.size(), 5, "Wrong number of columns");
+        NS_TEST_EXPECT_MSG_EQ(row[0].second, maxValues[i / (2 * runs)], "Wrong Max");
+        NS_TEST_EXPECT_MSG_EQ(row[1].second, scales[i / runs % 2], "Wrong scale");
+        NS_TEST_EXPECT_MSG_EQ(row[2].first, "run", "Wrong run column");
+        NS_TEST_EXPECT_MSG_EQ(row[2].second, std::to_string(5 + i % runs), "Wrong run");
+        NS_TEST_EXPECT_MSG_EQ((row[3] == expected[i][0][0]),
+                              true,
+                              "Wrong sum in replication " << i);
+        NS_TEST_EXPECT_MSG_EQ((row[4] == expected[i][0][1]),
+                              true,
+                              "Wrong time in replication " << i);
+        NS_TEST_EXPECT_MSG_EQ((results[2 * i + 1][3] == expected[i][1][0]),
+                              true,
+                              "Wrong escaping");
+    }
+    NS_TEST_EXPECT_MSG_EQ((results[0][3] != results[2][3]), true, "Same result for two runs");
+
+    NS_TEST_EXPECT_MSG_EQ(CreateObject<UniformRandomVariable>()->GetMax(),
+                          1,
+                          "Config changed by a replication");
+
+    std::ostringstream csv;
+    runner.WriteCsv(csv);
+    std::string header = csv.str().substr(0, csv.str().find('\n'));
+    NS_TEST_EXPECT_MSG_EQ(header,
+                          "ns3::UniformRandomVariable::Max,scale,run,sum,time,note",
+                          "Wrong CSV header");
+
+    ReplicationRunner failing;
+    failing.AddParameter("scale", {"1", "-1"});
+    failing.SetScenario(&ReplicationRunnerTestCase::Scenario);
+    failing.Run();
+    NS_TEST_EXPECT_MSG_EQ(failing.GetFailedCount(), 1, "The failure was not detected");
+    NS_TEST_EXPECT_MSG_EQ(failing.GetResults().size(), 2, "Wrong number of result rows");
+}
+
+/**
+ * @ingroup core-helpers-tests
+ *
+ * @brief The ReplicationRunner Test Suite.
+ */
+class ReplicationRunnerTestSuite : public TestSuite
+{
+  public:
+    ReplicationRunnerTestSuite()
+        : TestSuite("replication-runner")
+    {
+#ifndef __WIN32__
+        AddTestCase(new ReplicationRunnerTestCase(), TestCase::Duration::QUICK);
+#endif
+    }
+};
+
+/// Static variable for test initialization.
+static ReplicationRunnerTestSuite g_replicationRunnerTestSuite;
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @file
+ * @ingroup simulator-tests
+ * Simulator::Branch test suite
+ */
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that the branches of a simulation resume from the state of
+ * the parent, including the event queue and the random variable streams.
+ *
+ * Each branch writes its trace to a file, then exits.  The trace of each
+ * branch must be the trace of a simulation run without branching, with
+ * the same parameter.
+ */
+class SimulatorBranchTestCase : public TestCase
+{
+  public:
+    SimulatorBranchTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Schedule the scenario: a periodic event drawing random delays.
+     */
+    void Start();
+    /** Periodic event. */
+    void Tick();
+
+    /**
+     * Get the trace file of a branch.
+     * @param branch The branch index.
+     * @return The file name.
+     */
+    std::string GetTraceFile(uint32_t branch);
+
+    Ptr<UniformRandomVariable> m_random; //!< Random delays.
+    double m_scale;                      //!< Delay scale, the branch parameter.
+    std::vector<std::string> m_trace;    //!< The trace of the events.
+};
+
+/// Number of branches.
+static constexpr uint32_t BRANCHES = 3;
+/// Branching time.
+static const Time BRANCH_TIME = Seconds(1);
+/// End of the simulation.
+static const Time STOP_TIME = Seconds(3);
+
+SimulatorBranchTestCase::SimulatorBranchTestCase()
+    : TestCase("Check that the branches resume from the state of the parent")
+{
+}
+
+void
+SimulatorBranchTestCase::Start()
+{
+    m_random = CreateObject<UniformRandomVariable>();
+    m_random->SetStream(1);
+    m_scale = 1;
+    m_trace.clear();
+    Simulator::Schedule(Seconds(0), &SimulatorBranchTestCase::Tick, this);
+    Simulator::Stop(STOP_TIME);
+}
+
+void
+SimulatorBranchTestCase::Tick()
+{
+    double delay = m_random->GetValue(1, 100) * m_scale;
+    m_trace.push_back(std::to_string(Simulator::Now().GetTimeStep()) + " " +
+                      std::to_string(delay));
+    Simulator::Schedule(MilliSeconds(delay), &SimulatorBranchTestCase::Tick, this);
+}
+
+std::string
+SimulatorBranchTestCase::GetTraceFile(uint32_t branch)
+{
+    return CreateTempDirFilename("branch-" + std::to_string(branch) + ".txt");
+}
+
+void
+SimulatorBranchTestCase::DoRun()
+{
+    // Expected traces: the parameter is changed at BRANCH_TIME, without branching.
+    std::vector<std::vector<std::string>> expected;
+    for (uint32_t i = 0; i < BRANCHES; ++i)
+    {
+        Start();
+        Simulator::Schedule(BRANCH_TIME, [this, i]() { m_scale = i + 1; });
+        Simulator::Run();
+        expected.push_back(m_trace);
+        Simulator::Destroy();
+    }
+
+    Start();
+    Simulator::ScheduleBranch(BRANCH_TIME, BRANCHES, [this](uint32_t branch) {
+        m_scale = branch + 1;
+    });
+    Simulator::Run();
+    if (Simulator::GetBranch() != Simulator::NO_BRANCH)
+    {
+        std::ofstream os(GetTraceFile(Simulator::GetBranch()));
+        for (const auto& line : m_trace)
+        {
+            os << line << "\n";
+        }
+        os.close();
+        // Leave the test runner to the parent.
+        std::_Exit(os.fail() ? 1 : 0);
+    }
+
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), BRANCH_TIME, "The parent did not stop at the branch");
+    NS_TEST_EXPECT_MSG_EQ(Simulator::GetFailedBranchCount(), 0, "A branch failed");
+    Simulator::Destroy();
+
+    for (uint32_t i = 0; i < BRANCHES; ++i)
+    {
+        std::ifstream is(GetTraceFile(i));
+        std::vector<std::string> trace;
+        std::string line;
+        while (std::getline(is, line))
+        {
+            trace.push_back(line);
+        }
+        NS_TEST_EXPECT_MSG_GT(trace.size(), 0, "No trace for branch " << i);
+        NS_TEST_EXPECT_MSG_EQ((trace == expected[i]), true, "Trace mismatch in branch " << i);
+    }
+    NS_TEST_EXPECT_MSG_EQ((expected[0] != expected[1]), true, "The parameter has no effect");
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief The Simulator::Branch Test Suite.
+ */
+class SimulatorBranchTestSuite : public TestSuite
+{
+  public:
+    SimulatorBranchTestSuite()
+        : TestSuite("simulator-branch")
+    {
+#ifndef __WIN32__
+        AddTestCase(new SimulatorBranchTestCase(), TestCase::Duration::QUICK);
+#endif
+    }
+};
+
+/// Static variable for test initialization.
+static SimulatorBranchTestSuite g_simulatorBranchTestSuite;
@@ -6,13 +6,25 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 #include "ns3/calendar-scheduler.h"
+#include "ns3/event-impl.h"
+#include "ns3/event-profiler.h"
 #include "ns3/heap-scheduler.h"
+#include "ns3/ladder-scheduler.h"
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/simulator-impl.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
 
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
 using namespace ns3;
 
 /**
@@ -200,6 +212,452 @@ SimulatorEventsTestCase::DoRun()
     NS_TEST_EXPECT_MSG_EQ(m_destroy, true, "Event should have run");
 }
 
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that a scheduler returns events in EventKey order.
+ *
+ * The event timestamps are skewed on purpose: bursts of events a few
+ * nanoseconds apart are mixed with events seconds in the future, and
+ * some events are removed before they are due.  Then a large burst of
+ * events on a few timestamps is drained while more events are inserted
+ * on the same timestamps.
+ */
+class SchedulerOrderTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * @param schedulerFactory Scheduler factory.
+     */
+    SchedulerOrderTestCase(ObjectFactory schedulerFactory);
+    void DoRun() override;
+
+  private:
+    ObjectFactory m_schedulerFactory; //!< Scheduler factory.
+};
+
+SchedulerOrderTestCase::SchedulerOrderTestCase(ObjectFactory schedulerFactory)
+    : TestCase("Check the event ordering of " + schedulerFactory.GetTypeId().GetName()),
+      m_schedulerFactory(schedulerFactory)
+{
+}
+
+void
+SchedulerOrderTestCase::DoRun()
+{
+    Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler>();
+    std::mt19937_64 rng(1);
+    std::vector<Scheduler::Event> pending;
+    uint64_t now = 0;
+    uint32_t uid = EventId::UID::VALID;
+    uint32_t removed = 0;
+
+    auto insertAt = [&](uint64_t ts) {
+        Scheduler::Event ev;
+        ev.impl = nullptr;
+        ev.key.m_ts = ts;
+        ev.key.m_uid = uid++;
+        ev.key.m_context = 0;
+        scheduler->Insert(ev);
+        pending.push_back(ev);
+    };
+    auto insert = [&]() {
+        uint64_t delay;
+        switch (rng() % 4)
+        {
+        case 0:
+            delay = 1000000000 + rng() % 1000000000; // application timer
+            break;
+        case 1:
+            delay = 0;
+            break;
+        default:
+            delay = rng() % 20; // burst
+            break;
+        }
+        insertAt(now + delay);
+    };
+
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        insert();
+    }
+    Scheduler::Event last{nullptr, {0, 0, 0}};
+    uint32_t events = 0;
+    while (!scheduler->IsEmpty())
+    {
+        if (rng() % 10 == 0 && !pending.empty())
+        {
+            std::size_t index = rng() % pending.size();
+            scheduler->Remove(pending[index]);
+            pending[index] = pending.back();
+            pending.pop_back();
+            removed++;
+            continue;
+        }
+        Scheduler::Event peek = scheduler->PeekNext();
+        Scheduler::Event next = scheduler->RemoveNext();
+        NS_TEST_ASSERT_MSG_EQ(peek.key.m_uid, next.key.m_uid, "PeekNext and RemoveNext differ");
+        NS_TEST_ASSERT_MSG_EQ((last.key < next.key), true, "Events out of order");
+        last = next;
+        now = next.key.m_ts;
+        pending.erase(std::find(pending.begin(), pending.end(), next));
+        if (++events < 3000)
+        {
+            insert();
+            if (rng() % 2 == 0)
+            {
+                insert();
+            }
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(pending.empty(), true, "Events were lost");
+    NS_TEST_EXPECT_MSG_GT(removed, 0, "No event was removed");
+
+    for (uint32_t i = 0; i < 5000; ++i)
+    {
+        insertAt(now + 100 + rng() % 3);
+    }
+    events = 0;
+    while (!scheduler->IsEmpty())
+    {
+        Scheduler::Event next = scheduler->RemoveNext();
+        NS_TEST_ASSERT_MSG_EQ((last.key < next.key), true, "Burst events out of order");
+        last = next;
+        now = next.key.m_ts;
+        pending.erase(std::find(pending.begin(), pending.end(), next));
+        if (++events < 3000)
+        {
+            insertAt(now + rng() % 3);
+        }
+        if (events % 7 == 0 && !pending.empty())
+        {
+            std::size_t index = rng() % pending.size();
+            scheduler->Remove(pending[index]);
+            pending[index] = pending.back();
+            pending.pop_back();
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(pending.empty(), true, "Burst events were lost");
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that the storage of the events is recycled.
+ *
+ * Events of several size classes, including events too large for the pool,
+ * are scheduled and cancelled in rounds; after the first round, the pool
+ * must not request more memory.  Events created by another thread and
+ * released by the simulator thread must be recycled as well.
+ */
+class EventPoolTestCase : public TestCase
+{
+  public:
+    EventPoolTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Schedule events of several sizes, cancel some of them and run them.
+     * @param count The number of events of each size.
+     */
+    void RunRound(uint32_t count);
+
+    uint32_t m_ran;       //!< Number of events which ran.
+    uint32_t m_cancelled; //!< Number of cancelled events which ran.
+};
+
+EventPoolTestCase::EventPoolTestCase()
+    : TestCase("Check the recycling of the event storage")
+{
+}
+
+void
+EventPoolTestCase::RunRound(uint32_t count)
+{
+    std::array<uint8_t, 100> medium{};
+    std::array<uint8_t, 400> large{};
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        Simulator::Schedule(NanoSeconds(i), [this]() { m_ran++; });
+        Simulator::Schedule(NanoSeconds(i), [this, medium]() { m_ran += medium[0] + 1; });
+        EventId id = Simulator::Schedule(NanoSeconds(i), [this, large]() { m_cancelled++; });
+        if (i % 2 == 0)
+        {
+            id.Cancel();
+        }
+        else
+        {
+            Simulator::Remove(id);
+        }
+    }
+    Simulator::Run();
+}
+
+void
+EventPoolTestCase::DoRun()
+{
+    m_ran = 0;
+    m_cancelled = 0;
+    RunRound(10000);
+    std::size_t reserved = EventImpl::GetPoolReservedBytes();
+    NS_TEST_EXPECT_MSG_GT(reserved, 0, "The pool is not used");
+    for (uint32_t round = 0; round < 5; ++round)
+    {
+        RunRound(10000);
+    }
+    NS_TEST_EXPECT_MSG_EQ(m_ran, 6 * 2 * 10000, "Wrong number of events run");
+    NS_TEST_EXPECT_MSG_EQ(m_cancelled, 0, "Cancelled or removed events ran");
+    NS_TEST_EXPECT_MSG_EQ(EventImpl::GetPoolReservedBytes(), reserved, "Storage not recycled");
+
+    // Producer threads: all their events are released by this thread.  Without
+    // recycling, each round would need 10000 more blocks.
+    for (uint32_t round = 0; round < 20; ++round)
+    {
+        std::vector<EventImpl*> events;
+        std::thread producer([&events]() {
+            for (uint32_t i = 0; i < 10000; ++i)
+            {
+                events.push_back(MakeEvent([]() {}));
+            }
+        });
+        producer.join();
+        for (auto event : events)
+        {
+            event->Unref();
+        }
+    }
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(EventImpl::GetPoolReservedBytes(),
+                                reserved + 1024 * 1024,
+                                "Storage released by another thread not recycled");
+
+    // Over-aligned events are not allocated from the pool.
+    struct alignas(64) Aligned
+    {
+        uint8_t value; //!< A value.
+    };
+
+    Aligned aligned{};
+    bool misaligned = false;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        Simulator::Schedule(NanoSeconds(i), [&misaligned, aligned]() {
+            misaligned |= reinterpret_cast<uintptr_t>(&aligned) % alignof(Aligned) != 0;
+        });
+    }
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(misaligned, false, "Over-aligned event misaligned");
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check the attribution of the event costs by the EventProfiler.
+ */
+class EventProfilerTestCase : public TestCase
+{
+  public:
+    EventProfilerTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run a simulation with the profiler enabled.
+     * @param filename The profile output file.
+     */
+    void RunProfiled(const std::string& filename);
+
+    /** Event which takes some time. */
+    void Slow();
+    /** Event of the same type as Slow() which returns immediately. */
+    void Idle();
+    /**
+     * Event which returns immediately.
+     * @param n An argument.
+     */
+    void Fast(uint32_t n);
+
+    std::string m_slowCallee; //!< The name of Slow() in the last profile.
+};
+
+EventProfilerTestCase::EventProfilerTestCase()
+    : TestCase("Check the EventProfiler")
+{
+}
+
+void
+EventProfilerTestCase::Slow()
+{
+    auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+void
+EventProfilerTestCase::Idle()
+{
+}
+
+void
+EventProfilerTestCase::Fast(uint32_t n)
+{
+}
+
+void
+EventProfilerTestCase::RunProfiled(const std::string& filename)
+{
+    ObjectFactory factory;
+    factory.SetTypeId("ns3::DefaultSimulatorImpl");
+    factory.Set("EventProfile", StringValue(filename));
+    auto impl = factory.Create<SimulatorImpl>();
+    Simulator::SetImplementation(impl);
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        Simulator::ScheduleWithContext(7, MicroSeconds(i), &EventProfilerTestCase::Slow, this);
+        Simulator::ScheduleWithContext(7, MicroSeconds(i), &EventProfilerTestCase::Idle, this);
+        Simulator::Schedule(MicroSeconds(i), &EventProfilerTestCase::Fast, this, i);
+    }
+    Simulator::Run();
+
+    auto histogram = impl->GetEventProfiler()->GetHistogram();
+    NS_TEST_ASSERT_MSG_EQ(histogram.size(), 3, "Wrong number of callees");
+    // Slow() is named by its symbol, or by its type and address.
+    m_slowCallee = histogram[0].callee;
+    NS_TEST_EXPECT_MSG_NE(m_slowCallee.find("EventProfilerTestCase::"),
+                          std::string::npos,
+                          "Slowest callee not first");
+    NS_TEST_EXPECT_MSG_EQ(histogram[0].context, 7, "Wrong context");
+    NS_TEST_EXPECT_MSG_EQ(histogram[0].count, 10, "Wrong event count");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(histogram[0].totalNs, 10 * 200000, "Cost not measured");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(histogram[0].maxNs, 200000, "Maximum cost not measured");
+    for (std::size_t i = 1; i < histogram.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_NE(histogram[i].callee,
+                              m_slowCallee,
+                              "Methods of the same type not told apart");
+        NS_TEST_EXPECT_MSG_EQ(histogram[i].count, 10, "Wrong event count");
+        NS_TEST_EXPECT_MSG_EQ(histogram[i].context,
+                              (histogram[i].callee.find("Fast") != std::string::npos ||
+                                       histogram[i].callee.find("unsigned int") != std::string::npos
+                                   ? Simulator::NO_CONTEXT
+                                   : 7),
+                              "Wrong context of " << histogram[i].callee);
+    }
+    Simulator::Destroy();
+}
+
+void
+EventProfilerTestCase::DoRun()
+{
+    std::string csv = CreateTempDirFilename("profile.csv");
+    RunProfiled(csv);
+    std::ifstream is(csv);
+    std::string line;
+    std::vector<std::string> lines;
+    while (std::getline(is, line))
+    {
+        lines.push_back(line);
+    }
+    NS_TEST_ASSERT_MSG_EQ(lines.size(), 4, "Wrong number of CSV lines");
+    NS_TEST_EXPECT_MSG_EQ(lines[0], "callee,context,count,total_ns,mean_ns,max_ns", "Bad header");
+    NS_TEST_EXPECT_MSG_EQ(lines[1].rfind("\"" + m_slowCallee + "\",7,10,", 0),
+                          0,
+                          "Bad CSV record " << lines[1]);
+
+    std::string json = CreateTempDirFilename("profile.json");
+    RunProfiled(json);
+    std::ifstream js(json);
+    std::getline(js, line);
+    NS_TEST_EXPECT_MSG_EQ(line, "{", "Not a JSON profile");
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that the EventProfiler excludes the cost of the events
+ * invoked with SimulatorImpl::InvokeWithContext() from that of the caller.
+ */
+class EventProfilerNestedTestCase : public TestCase
+{
+  public:
+    EventProfilerNestedTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** Event which invokes Slow() in context 7. */
+    void FanOut();
+    /** Event which takes some time. */
+    void Slow();
+
+    Ptr<SimulatorImpl> m_impl; //!< The simulator implementation.
+    uint32_t m_context;        //!< The context of the last Slow() event.
+};
+
+EventProfilerNestedTestCase::EventProfilerNestedTestCase()
+    : TestCase("Check the EventProfiler with nested events")
+{
+}
+
+void
+EventProfilerNestedTestCase::FanOut()
+{
+    Ptr<EventImpl> event(MakeEvent(&EventProfilerNestedTestCase::Slow, this), false);
+    m_impl->InvokeWithContext(7, PeekPointer(event));
+    NS_TEST_EXPECT_MSG_EQ(m_context, 7, "Nested event not run in its context");
+    NS_TEST_EXPECT_MSG_EQ(Simulator::GetContext(), 3, "Context of the caller not restored");
+}
+
+void
+EventProfilerNestedTestCase::Slow()
+{
+    m_context = Simulator::GetContext();
+    auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+void
+EventProfilerNestedTestCase::DoRun()
+{
+    ObjectFactory factory;
+    factory.SetTypeId("ns3::DefaultSimulatorImpl");
+    factory.Set("EventProfile", StringValue(CreateTempDirFilename("nested.csv")));
+    m_impl = factory.Create<SimulatorImpl>();
+    Simulator::SetImplementation(m_impl);
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        Simulator::ScheduleWithContext(3,
+                                       MicroSeconds(i),
+                                       &EventProfilerNestedTestCase::FanOut,
+                                       this);
+    }
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(Simulator::GetEventCount(), 20, "Nested events not counted");
+
+    auto histogram = m_impl->GetEventProfiler()->GetHistogram();
+    NS_TEST_ASSERT_MSG_EQ(histogram.size(), 2, "Wrong number of callees");
+    NS_TEST_EXPECT_MSG_EQ(histogram[0].context, 7, "Nested event not profiled first");
+    NS_TEST_EXPECT_MSG_EQ(histogram[0].count, 10, "Wrong nested event count");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(histogram[0].totalNs, 10 * 200000, "Cost not measured");
+    NS_TEST_EXPECT_MSG_EQ(histogram[1].context, 3, "Wrong context of the caller");
+    NS_TEST_EXPECT_MSG_EQ(histogram[1].count, 10, "Wrong caller event count");
+    NS_TEST_EXPECT_MSG_LT(histogram[1].totalNs,
+                          10 * 200000,
+                          "Cost of the nested events counted for the caller");
+    Simulator::Destroy();
+    m_impl = nullptr;
+}
+
 /**
  * @ingroup simulator-tests
  *
@@ -663,6 +1121,21 @@ class SimulatorTestSuite : public TestSuite
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        factory.SetTypeId(LadderScheduler::GetTypeId());
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+
+        for (const auto& tid : {MapScheduler::GetTypeId(),
+                                HeapScheduler::GetTypeId(),
+                                CalendarScheduler::GetTypeId(),
+                                PriorityQueueScheduler::GetTypeId(),
+                                LadderScheduler::GetTypeId()})
+        {
+            factory.SetTypeId(tid);
+            AddTestCase(new SchedulerOrderTestCase(factory), TestCase::Duration::QUICK);
+        }
+        AddTestCase(new EventPoolTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new EventProfilerTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new EventProfilerNestedTestCase(), TestCase::Duration::QUICK);
     }
 };
 
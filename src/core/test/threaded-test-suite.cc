@@ -5,8 +5,10 @@
  *
  * Author: Claudio Freire <claudio-daniel.freire@inria.fr>
  */
+#include "ns3/boolean.h"
 #include "ns3/calendar-scheduler.h"
 #include "ns3/config.h"
+#include "ns3/default-simulator-impl.h"
 #include "ns3/heap-scheduler.h"
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
@@ -251,6 +253,11 @@ ThreadedSimulatorEventsTestCase::DoRun()
     Simulator::Schedule(MicroSeconds(10), &ThreadedSimulatorEventsTestCase::EventA, this, 1);
     Simulator::Schedule(Seconds(1), &ThreadedSimulatorEventsTestCase::End, this);
 
+    auto impl = DynamicCast<DefaultSimulatorImpl>(Simulator::GetImplementation());
+    if (impl)
+    {
+        impl->SetAttribute("MeasureInjectionLatency", BooleanValue(true));
+    }
     for (unsigned int i = 0; i < m_threads; ++i)
     {
         m_threadlist.emplace_back(
@@ -259,6 +266,14 @@ ThreadedSimulatorEventsTestCase::DoRun()
     }
 
     Simulator::Run();
+
+    if (impl && m_threads > 0)
+    {
+        NS_TEST_EXPECT_MSG_GT(impl->GetInjectedEventCount(), 0, "No event injected by threads");
+        NS_TEST_EXPECT_MSG_GT_OR_EQ(impl->GetMaxInjectionLatency(),
+                                    impl->GetMeanInjectionLatency(),
+                                    "Inconsistent injection latency");
+    }
     Simulator::Destroy();
 
     NS_TEST_EXPECT_MSG_EQ(m_error.empty(), true, m_error);
@@ -281,12 +296,14 @@ class ThreadedSimulatorTestSuite : public TestSuite
         std::string simulatorTypes[] = {
             "ns3::RealtimeSimulatorImpl",
             "ns3::DefaultSimulatorImpl",
+            "ns3::MultithreadedSimulatorImpl",
         };
         std::string schedulerTypes[] = {
             "ns3::ListScheduler",
             "ns3::HeapScheduler",
             "ns3::MapScheduler",
             "ns3::CalendarScheduler",
+            "ns3::LadderScheduler",
         };
         unsigned int threadCounts[] = {0, 2, 10, 20};
         ObjectFactory factory;
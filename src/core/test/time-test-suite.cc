@@ -523,6 +523,42 @@ TimeInputOutputTestCase::DoRun()
     CheckAs(t * 1e+8, "+9.961925y");
 }
 
+/**
+ * @ingroup core-tests
+ * @brief Check the Times built and compared at compile time.
+ */
+class TimeConstexprTestCase : public TestCase
+{
+  public:
+    TimeConstexprTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+TimeConstexprTestCase::TimeConstexprTestCase()
+    : TestCase("Check the constexpr Times")
+{
+}
+
+void
+TimeConstexprTestCase::DoRun()
+{
+    constexpr Time zero;
+    constexpr Time step = TimeStep(10);
+    constexpr Time sum = step + TimeStep(5) - TimeStep(1);
+    static_assert(zero.IsZero() && step.IsStrictlyPositive());
+    static_assert(sum.GetTimeStep() == 14);
+    static_assert(sum * 3 == TimeStep(42) && sum / 7 == TimeStep(2));
+    static_assert(Max(step, sum) == sum && Min(step, sum) == step);
+    static_assert(Abs(TimeStep(0) - step) == step && sum % step == TimeStep(4));
+    static_assert(Time::Max() > sum && Time::Min() < zero);
+
+    // Constant Times equal the Times built at run time.
+    NS_TEST_EXPECT_MSG_EQ(sum, NanoSeconds(14), "Wrong constexpr Time");
+    NS_TEST_EXPECT_MSG_EQ(Time(sum).GetNanoSeconds(), 14, "Wrong copy of a constexpr Time");
+}
+
 /**
  * @ingroup core-tests
  * @brief   Time test Suite.  Runs the appropriate test cases for time
@@ -535,6 +571,7 @@ static class TimeTestSuite : public TestSuite
     {
         AddTestCase(new TimeWithSignTestCase(), TestCase::Duration::QUICK);
         AddTestCase(new TimeInputOutputTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new TimeConstexprTestCase(), TestCase::Duration::QUICK);
         // This should be last, since it changes the resolution
         AddTestCase(new TimeSimpleTestCase(), TestCase::Duration::QUICK);
     }
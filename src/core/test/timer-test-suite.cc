@@ -5,11 +5,17 @@
  *
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
+#include "ns3/config.h"
 #include "ns3/nstime.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/timer-coalescer.h"
 #include "ns3/timer.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 /**
  * @file
  * @ingroup timer-tests
@@ -203,6 +209,101 @@ TimerTemplateTestCase::DoTeardown()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup timer-tests
+ *
+ * @brief Check that the coalesced timers share the scheduler events, and
+ * run at the right time, in their context and in schedule order.
+ */
+class TimerCoalescingTestCase : public TestCase
+{
+  public:
+    TimerCoalescingTestCase();
+    void DoRun() override;
+
+    /**
+     * Expire function of the timers: record the timer, the time and the context.
+     * @param [in] i The index of the timer.
+     */
+    void Expire(uint32_t i);
+
+  private:
+    /**
+     * Run the timers.
+     * @param [in] coalescing Whether the timers are coalesced.
+     * @returns The number of coalesced events.
+     */
+    uint64_t RunTimers(bool coalescing);
+
+    std::vector<std::unique_ptr<Timer>> m_timers; //!< The timers.
+    std::vector<std::string> m_trace;             //!< The expired timers.
+};
+
+TimerCoalescingTestCase::TimerCoalescingTestCase()
+    : TestCase("Check the coalesced timers")
+{
+}
+
+void
+TimerCoalescingTestCase::Expire(uint32_t i)
+{
+    m_trace.push_back(std::to_string(i) + " " + std::to_string(Now().GetMilliSeconds()) + " " +
+                      std::to_string(Simulator::GetContext()));
+    if (i == 0)
+    {
+        // Timer 2 expires at the same time, after this one.
+        NS_TEST_EXPECT_MSG_EQ(m_timers[2]->IsRunning(), true, "Timer 2 already expired");
+        NS_TEST_EXPECT_MSG_EQ(m_timers[0]->IsRunning(), false, "Timer 0 still running");
+        m_timers[2]->Cancel();
+    }
+}
+
+uint64_t
+TimerCoalescingTestCase::RunTimers(bool coalescing)
+{
+    m_timers.clear();
+    m_trace.clear();
+    // Timers 0, 1, 2 and 4 expire at 20 ms, timer 3 at 21 ms.
+    const std::vector<uint32_t> starts{10, 10, 11, 10, 10};
+    const std::vector<uint32_t> delays{10, 10, 9, 11, 10};
+    for (uint32_t i = 0; i < delays.size(); ++i)
+    {
+        m_timers.push_back(std::make_unique<Timer>(Timer::CANCEL_ON_DESTROY));
+        m_timers[i]->SetCoalescing(coalescing);
+        m_timers[i]->SetFunction(&TimerCoalescingTestCase::Expire, this);
+        m_timers[i]->SetArguments(i);
+        Simulator::ScheduleWithContext(i, MilliSeconds(starts[i]), [this, i, delays]() {
+            m_timers[i]->Schedule(MilliSeconds(delays[i]));
+        });
+    }
+    Simulator::Run();
+    uint64_t buckets = TimerCoalescer::GetBucketCount();
+    m_timers.clear();
+    Simulator::Destroy();
+    return buckets;
+}
+
+void
+TimerCoalescingTestCase::DoRun()
+{
+    uint64_t buckets = RunTimers(true);
+    NS_TEST_EXPECT_MSG_EQ(buckets, 2, "Wrong number of scheduler events");
+    std::vector<std::string> expected{"0 20 0", "1 20 1", "4 20 4", "3 21 3"};
+    NS_TEST_EXPECT_MSG_EQ((m_trace == expected), true, "Wrong expired timers");
+
+    Config::SetGlobal("TimerCoalescingGranularity", TimeValue(MilliSeconds(8)));
+    buckets = RunTimers(true);
+    NS_TEST_EXPECT_MSG_EQ(buckets, 1, "Wrong number of scheduler events with granularity");
+    expected = {"0 24 0", "1 24 1", "3 24 3", "4 24 4"};
+    NS_TEST_EXPECT_MSG_EQ((m_trace == expected), true, "Wrong expired timers with granularity");
+    Config::SetGlobal("TimerCoalescingGranularity", TimeValue(Seconds(0)));
+
+    buckets = RunTimers(false);
+    NS_TEST_EXPECT_MSG_EQ(buckets, 0, "Uncoalesced timers coalesced");
+    expected = {"0 20 0", "1 20 1", "4 20 4", "3 21 3"};
+    NS_TEST_EXPECT_MSG_EQ((m_trace == expected), true, "Wrong expired uncoalesced timers");
+}
+
 /**
  * @ingroup timer-tests
  *
@@ -216,6 +317,7 @@ class TimerTestSuite : public TestSuite
     {
         AddTestCase(new TimerStateTestCase(), TestCase::Duration::QUICK);
         AddTestCase(new TimerTemplateTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new TimerCoalescingTestCase(), TestCase::Duration::QUICK);
     }
 };
 
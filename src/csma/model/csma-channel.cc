@@ -11,6 +11,7 @@
 #include "csma-net-device.h"
 
 #include "ns3/log.h"
+#include "ns3/multithreaded-simulator-impl.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 
@@ -66,6 +67,8 @@ CsmaChannel::Attach(Ptr<CsmaNetDevice> device)
     CsmaDeviceRec rec(device);
 
     m_deviceList.push_back(rec);
+    // Packets reach the other devices m_delay after the end of their transmission.
+    MultithreadedSimulatorImpl::BoundSimulatorLookAhead(m_delay);
     return (m_deviceList.size() - 1);
 }
 
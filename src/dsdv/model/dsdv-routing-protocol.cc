@@ -165,7 +165,15 @@ RoutingProtocol::GetTypeId()
                           "Time to aggregate updates before sending them out (in seconds)",
                           TimeValue(Seconds(1)),
                           MakeTimeAccessor(&RoutingProtocol::m_routeAggregationTime),
-                          MakeTimeChecker());
+                          MakeTimeChecker())
+            .AddAttribute("TimerCoalescing",
+                          "Whether the periodic update timers of all the nodes share their "
+                          "scheduler events (see ns3::TimerCoalescer). The updates are jittered "
+                          "by up to 25 ms, so only a TimerCoalescingGranularity of that order "
+                          "coalesces them.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&RoutingProtocol::m_timerCoalescing),
+                          MakeBooleanChecker());
     return tid;
 }
 
@@ -261,6 +269,7 @@ RoutingProtocol::Start()
     m_scb = MakeCallback(&RoutingProtocol::Send, this);
     m_ecb = MakeCallback(&RoutingProtocol::Drop, this);
     m_periodicUpdateTimer.SetFunction(&RoutingProtocol::SendPeriodicUpdate, this);
+    m_periodicUpdateTimer.SetCoalescing(m_timerCoalescing);
     m_periodicUpdateTimer.Schedule(MicroSeconds(m_uniformRandomVariable->GetInteger(0, 1000)));
 }
 
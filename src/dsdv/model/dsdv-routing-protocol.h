@@ -176,6 +176,8 @@ class RoutingProtocol : public Ipv4RoutingProtocol
     bool EnableRouteAggregation;
     /// Parameter that holds the route aggregation time interval
     Time m_routeAggregationTime;
+    /// Flag that is used to coalesce the periodic update timers
+    bool m_timerCoalescing;
     /// Unicast callback for own packets
     UnicastForwardCallback m_scb;
     /// Error callback for own packets
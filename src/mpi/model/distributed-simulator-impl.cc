@@ -308,7 +308,7 @@ DistributedSimulatorImpl::ProcessOneEvent()
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    InvokeEvent(next.impl, next.key.m_context);
     next.impl->Unref();
 }
 
@@ -228,7 +228,7 @@ NullMessageSimulatorImpl::ProcessOneEvent()
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    InvokeEvent(next.impl, next.key.m_context);
     next.impl->Unref();
 }
 
@@ -396,15 +396,34 @@ Buffer::AddAtEnd(const Buffer& o)
 {
     NS_LOG_FUNCTION(this << &o);
 
-    if (m_data->m_count == 1 && (m_end == m_zeroAreaEnd || m_zeroAreaStart == m_zeroAreaEnd) &&
-        m_end == m_data->m_dirtyEnd && o.m_start == o.m_zeroAreaStart &&
-        o.m_zeroAreaEnd - o.m_zeroAreaStart > 0)
+    if (&o == this)
+    {
+        Buffer copy = o;
+        AddAtEnd(copy);
+        return;
+    }
+    if (o.GetSize() == 0)
+    {
+        return;
+    }
+    if (GetSize() == 0)
+    {
+        *this = o;
+        return;
+    }
+
+    if ((m_end == m_zeroAreaEnd || m_zeroAreaStart == m_zeroAreaEnd) &&
+        o.m_start == o.m_zeroAreaStart && o.m_zeroAreaEnd - o.m_zeroAreaStart > 0)
     {
         /**
          * This is an optimization which kicks in when
          * we attempt to aggregate two buffers which contain
          * adjacent zero areas.
          */
+        if (m_data->m_count > 1 || m_end != m_data->m_dirtyEnd)
+        {
+            Unshare();
+        }
         if (m_zeroAreaStart == m_zeroAreaEnd)
         {
             m_zeroAreaStart = m_end;
@@ -424,11 +443,59 @@ Buffer::AddAtEnd(const Buffer& o)
         return;
     }
 
-    *this = CreateFullCopy();
-    AddAtEnd(o.GetSize());
-    Buffer::Iterator destStart = End();
-    destStart.Prev(o.GetSize());
-    destStart.Write(o.Begin(), o.End());
+    /**
+     * A buffer holds a single zero area: keep the larger of the
+     * two zero areas, and write the bytes of the other buffer,
+     * including its zero area, around it.
+     */
+    if (o.m_zeroAreaEnd - o.m_zeroAreaStart > m_zeroAreaEnd - m_zeroAreaStart)
+    {
+        Buffer front = *this;
+        *this = o;
+        if (m_data == front.m_data)
+        {
+            Unshare();
+        }
+        AddAtStart(front.GetSize());
+        Begin().Write(front.Begin(), front.End());
+    }
+    else
+    {
+        if (m_data == o.m_data)
+        {
+            Unshare();
+        }
+        AddAtEnd(o.GetSize());
+        Buffer::Iterator destStart = End();
+        destStart.Prev(o.GetSize());
+        destStart.Write(o.Begin(), o.End());
+    }
+    NS_ASSERT(CheckInternalState());
+}
+
+void
+Buffer::Unshare()
+{
+    NS_LOG_FUNCTION(this);
+    uint32_t size = GetInternalSize();
+    Buffer::Data* newData = Buffer::Create(size);
+    memcpy(newData->m_data, m_data->m_data + m_start, size);
+    m_data->m_count--;
+    if (m_data->m_count == 0)
+    {
+        Buffer::Recycle(m_data);
+    }
+    m_data = newData;
+
+    int32_t delta = -m_start;
+    m_zeroAreaStart += delta;
+    m_zeroAreaEnd += delta;
+    m_end += delta;
+    m_start += delta;
+
+    m_data->m_dirtyStart = m_start;
+    m_data->m_dirtyEnd = m_end;
+    LOG_INTERNAL_STATE("unshare ");
     NS_ASSERT(CheckInternalState());
 }
 
@@ -821,27 +888,35 @@ Buffer::Iterator::Write(Iterator start, Iterator end)
     NS_ASSERT(m_data != start.m_data);
     uint32_t size = end.m_current - start.m_current;
     NS_ASSERT_MSG(CheckNoZero(m_current, m_current + size), GetWriteErrorMessage());
+    uint8_t* to;
+    if (m_current <= m_zeroStart)
+    {
+        to = &m_data[m_current];
+    }
+    else
+    {
+        to = &m_data[m_current - (m_zeroEnd - m_zeroStart)];
+    }
+    m_current += size;
     if (start.m_current <= start.m_zeroStart)
     {
         uint32_t toCopy = std::min(size, start.m_zeroStart - start.m_current);
-        memcpy(&m_data[m_current], &start.m_data[start.m_current], toCopy);
+        memcpy(to, &start.m_data[start.m_current], toCopy);
         start.m_current += toCopy;
-        m_current += toCopy;
+        to += toCopy;
         size -= toCopy;
     }
     if (start.m_current <= start.m_zeroEnd)
     {
         uint32_t toCopy = std::min(size, start.m_zeroEnd - start.m_current);
-        memset(&m_data[m_current], 0, toCopy);
+        memset(to, 0, toCopy);
         start.m_current += toCopy;
-        m_current += toCopy;
+        to += toCopy;
         size -= toCopy;
     }
     uint32_t toCopy = std::min(size, start.m_dataEnd - start.m_current);
     uint8_t* from = &start.m_data[start.m_current - (start.m_zeroEnd - start.m_zeroStart)];
-    uint8_t* to = &m_data[m_current];
     memcpy(to, from, toCopy);
-    m_current += toCopy;
 }
 
 void
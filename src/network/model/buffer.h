@@ -517,6 +517,11 @@ class Buffer
      * Add bytes at the end of the Buffer.
      * Any call to this method invalidates any Iterator
      * pointing to this Buffer.
+     *
+     * The zero area of the result is not allocated: it is the
+     * concatenation of the zero areas of the two buffers if they
+     * are adjacent, or else the larger of them, while the bytes
+     * of the other one are copied.
      */
     void AddAtEnd(const Buffer& o);
     /**
@@ -684,6 +689,12 @@ class Buffer
      */
     Buffer CreateFullCopy() const;
 
+    /**
+     * @brief Copy the bytes of the buffer, but not its zero area,
+     * to a new storage which only this buffer references.
+     */
+    void Unshare();
+
     /**
      * @brief Transform a "Virtual byte buffer" into a "Real byte buffer"
      */
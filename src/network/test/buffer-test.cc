@@ -11,6 +11,8 @@
 #include "ns3/random-variable-stream.h"
 #include "ns3/test.h"
 
+#include <vector>
+
 using namespace ns3;
 
 /**
@@ -384,6 +386,133 @@ BufferTest::DoRun()
     NS_TEST_ASSERT_MSG_EQ(val1, val2, "Bad ReadNtohU16()");
 }
 
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * Check that appending buffers does not allocate their zero areas.
+ */
+class BufferZeroAreaTest : public TestCase
+{
+  private:
+    /**
+     * Checks the size and content of a buffer, and the size of its
+     * allocated bytes.
+     * @param b The buffer to check
+     * @param expected The bytes that should be in the buffer
+     * @param dataSize The number of bytes which are not in the zero area
+     */
+    void CheckBuffer(const Buffer& b, const std::vector<uint8_t>& expected, uint32_t dataSize);
+
+    /**
+     * Create a buffer with a zero area between a header and a trailer.
+     * @param header The header size
+     * @param zero The zero area size
+     * @param trailer The trailer size
+     * @param value The value of the header and trailer bytes
+     * @param [out] bytes The bytes of the buffer are appended to this vector
+     * @returns The buffer
+     */
+    Buffer CreateBuffer(uint32_t header,
+                        uint32_t zero,
+                        uint32_t trailer,
+                        uint8_t value,
+                        std::vector<uint8_t>& bytes);
+
+  public:
+    void DoRun() override;
+    BufferZeroAreaTest();
+};
+
+BufferZeroAreaTest::BufferZeroAreaTest()
+    : TestCase("Appending buffers keeps their zero areas")
+{
+}
+
+void
+BufferZeroAreaTest::CheckBuffer(const Buffer& b,
+                                const std::vector<uint8_t>& expected,
+                                uint32_t dataSize)
+{
+    NS_TEST_ASSERT_MSG_EQ(b.GetSize(), expected.size(), "Bad buffer size");
+    std::vector<uint8_t> got(b.GetSize());
+    b.CopyData(got.data(), got.size());
+    NS_TEST_ASSERT_MSG_EQ((got == expected), true, "Bad buffer content");
+    // The serialized buffer holds the bytes before and after the zero area,
+    // each padded to 4 bytes, and their sizes.
+    NS_TEST_ASSERT_MSG_LT_OR_EQ(b.GetSerializedSize(),
+                                12 + dataSize + 6,
+                                "The zero area was allocated");
+}
+
+Buffer
+BufferZeroAreaTest::CreateBuffer(uint32_t header,
+                                 uint32_t zero,
+                                 uint32_t trailer,
+                                 uint8_t value,
+                                 std::vector<uint8_t>& bytes)
+{
+    Buffer b(zero);
+    b.AddAtStart(header);
+    b.Begin().WriteU8(value, header);
+    b.AddAtEnd(trailer);
+    Buffer::Iterator i = b.End();
+    i.Prev(trailer);
+    i.WriteU8(value, trailer);
+    bytes.insert(bytes.end(), header, value);
+    bytes.insert(bytes.end(), zero, 0);
+    bytes.insert(bytes.end(), trailer, value);
+    return b;
+}
+
+void
+BufferZeroAreaTest::DoRun()
+{
+    // Padding after a trailer, as for the A-MPDU subframes.
+    std::vector<uint8_t> bytes;
+    Buffer buffer = CreateBuffer(30, 1400, 4, 0x11, bytes);
+    std::vector<uint8_t> padBytes;
+    buffer.AddAtEnd(CreateBuffer(0, 2, 0, 0, padBytes));
+    bytes.insert(bytes.end(), padBytes.begin(), padBytes.end());
+    CheckBuffer(buffer, bytes, 36);
+
+    // Appending to an empty buffer.
+    Buffer empty;
+    empty.AddAtEnd(buffer);
+    CheckBuffer(empty, bytes, 36);
+    buffer.AddAtEnd(Buffer());
+    CheckBuffer(buffer, bytes, 36);
+
+    // The larger zero area is kept, whichever buffer holds it.
+    bytes.clear();
+    Buffer small = CreateBuffer(8, 10, 0, 0x22, bytes);
+    Buffer large = CreateBuffer(8, 1000, 4, 0x33, bytes);
+    Buffer smallFirst = small;
+    smallFirst.AddAtEnd(large);
+    CheckBuffer(smallFirst, bytes, 30);
+    std::vector<uint8_t> largeFirstBytes(bytes.begin() + 18, bytes.end());
+    largeFirstBytes.insert(largeFirstBytes.end(), bytes.begin(), bytes.begin() + 18);
+    large.AddAtEnd(small);
+    CheckBuffer(large, largeFirstBytes, 30);
+
+    // Reassembling fragments, which share their storage with the original buffer.
+    bytes.clear();
+    Buffer original = CreateBuffer(28, 1472, 0, 0x44, bytes);
+    Buffer reassembled = original.CreateFragment(0, 500);
+    for (uint32_t start = 500; start < original.GetSize(); start += 500)
+    {
+        reassembled.AddAtEnd(original.CreateFragment(start, 500));
+    }
+    CheckBuffer(reassembled, bytes, 28);
+    CheckBuffer(original, bytes, 28);
+
+    // Appending a buffer to itself.
+    std::vector<uint8_t> twice = bytes;
+    twice.insert(twice.end(), bytes.begin(), bytes.end());
+    original.AddAtEnd(original);
+    CheckBuffer(original, twice, 28 + 1500);
+}
+
 /**
  * @ingroup network-test
  * @ingroup tests
@@ -400,6 +529,7 @@ BufferTestSuite::BufferTestSuite()
     : TestSuite("buffer", Type::UNIT)
 {
     AddTestCase(new BufferTest, TestCase::Duration::QUICK);
+    AddTestCase(new BufferZeroAreaTest, TestCase::Duration::QUICK);
 }
 
 static BufferTestSuite g_bufferTestSuite; //!< Static variable for test initialization
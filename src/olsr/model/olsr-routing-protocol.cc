@@ -220,6 +220,12 @@ RoutingProtocol::GetTypeId()
                                           "high",
                                           Willingness::ALWAYS,
                                           "always"))
+            .AddAttribute("TimerCoalescing",
+                          "Whether the HELLO, TC, MID and HNA timers of all the nodes share "
+                          "their scheduler events (see ns3::TimerCoalescer).",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&RoutingProtocol::m_timerCoalescing),
+                          MakeBooleanChecker())
             .AddTraceSource("Rx",
                             "Receive OLSR packet.",
                             MakeTraceSourceAccessor(&RoutingProtocol::m_rxPacketTrace),
@@ -437,6 +443,10 @@ RoutingProtocol::DoInitialize()
 
     if (canRunOlsr)
     {
+        m_helloTimer.SetCoalescing(m_timerCoalescing);
+        m_tcTimer.SetCoalescing(m_timerCoalescing);
+        m_midTimer.SetCoalescing(m_timerCoalescing);
+        m_hnaTimer.SetCoalescing(m_timerCoalescing);
         HelloTimerExpire();
         TcTimerExpire();
         MidTimerExpire();
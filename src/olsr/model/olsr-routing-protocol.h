@@ -250,6 +250,7 @@ class RoutingProtocol : public Ipv4RoutingProtocol
     Time m_midInterval;        //!< MID messages' emission interval.
     Time m_hnaInterval;        //!< HNA messages' emission interval.
     Willingness m_willingness; //!< Willingness for forwarding packets on behalf of other nodes.
+    bool m_timerCoalescing;    //!< Whether the message timers are coalesced.
 
     OlsrState m_state; //!< Internal state with all needed data structs.
     Ptr<Ipv4> m_ipv4;  //!< IPv4 object the routing is linked to.
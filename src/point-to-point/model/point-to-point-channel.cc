@@ -9,6 +9,7 @@
 #include "point-to-point-net-device.h"
 
 #include "ns3/log.h"
+#include "ns3/multithreaded-simulator-impl.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
@@ -61,6 +62,8 @@ PointToPointChannel::Attach(Ptr<PointToPointNetDevice> device)
     NS_ASSERT(device);
 
     m_link[m_nDevices++].m_src = device;
+    // Packets reach the other device at least m_delay after they are sent.
+    MultithreadedSimulatorImpl::BoundSimulatorLookAhead(m_delay);
     //
     // If we have both devices connected to the channel, then finish introducing
     // the two halves and set the links to IDLE.
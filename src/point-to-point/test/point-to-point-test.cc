@@ -6,14 +6,19 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 
+#include "ns3/data-rate.h"
 #include "ns3/drop-tail-queue.h"
+#include "ns3/multithreaded-simulator-impl.h"
 #include "ns3/net-device-queue-interface.h"
+#include "ns3/object-factory.h"
 #include "ns3/point-to-point-channel.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -128,6 +133,131 @@ PointToPointTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @brief Test of the PointToPoint model with the MultithreadedSimulatorImpl
+ *
+ * Two nodes exchange packets over a PointToPointChannel; the packets must
+ * be received at the same times as with the DefaultSimulatorImpl, and the
+ * channel must bound the lookahead of the simulator to its delay.
+ */
+class PointToPointMultithreadedTest : public TestCase
+{
+  public:
+    /**
+     * @brief Create the test
+     */
+    PointToPointMultithreadedTest();
+
+    /**
+     * @brief Run the test
+     */
+    void DoRun() override;
+
+  private:
+    /**
+     * @brief Exchange packets between two nodes
+     *
+     * @param impl The simulator implementation.
+     * @return The (time in ns, size) pairs of the received packets.
+     */
+    std::vector<std::pair<int64_t, uint32_t>> Exchange(Ptr<SimulatorImpl> impl);
+    /**
+     * @brief Send one packet from a device
+     *
+     * @param device The sending device.
+     * @param size The size of the packet.
+     */
+    void Send(Ptr<PointToPointNetDevice> device, uint32_t size);
+    /**
+     * @brief Callback function which records the received packet
+     *
+     * @param dev The receiving device.
+     * @param pkt The received packet.
+     * @param mode The protocol mode used.
+     * @param sender The sender address.
+     *
+     * @return A boolean indicating packet handled properly.
+     */
+    bool RxPacket(Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address& sender);
+
+    std::vector<std::pair<int64_t, uint32_t>> m_received; //!< The received packets
+};
+
+PointToPointMultithreadedTest::PointToPointMultithreadedTest()
+    : TestCase("PointToPoint with the MultithreadedSimulatorImpl")
+{
+}
+
+void
+PointToPointMultithreadedTest::Send(Ptr<PointToPointNetDevice> device, uint32_t size)
+{
+    device->Send(Create<Packet>(size), device->GetBroadcast(), 0x800);
+}
+
+bool
+PointToPointMultithreadedTest::RxPacket(Ptr<NetDevice> dev,
+                                        Ptr<const Packet> pkt,
+                                        uint16_t mode,
+                                        const Address& sender)
+{
+    m_received.emplace_back(Simulator::Now().GetNanoSeconds(), pkt->GetSize());
+    return true;
+}
+
+std::vector<std::pair<int64_t, uint32_t>>
+PointToPointMultithreadedTest::Exchange(Ptr<SimulatorImpl> impl)
+{
+    m_received.clear();
+    Simulator::SetImplementation(impl);
+
+    Ptr<PointToPointChannel> channel = CreateObject<PointToPointChannel>();
+    channel->SetAttribute("Delay", TimeValue(MilliSeconds(2)));
+    std::vector<Ptr<PointToPointNetDevice>> devices;
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        Ptr<Node> node = CreateObject<Node>();
+        Ptr<PointToPointNetDevice> device = CreateObject<PointToPointNetDevice>();
+        device->SetAttribute("DataRate", DataRateValue(DataRate("10Mbps")));
+        device->Attach(channel);
+        device->SetAddress(Mac48Address::Allocate());
+        device->SetQueue(CreateObject<DropTailQueue<Packet>>());
+        node->AddDevice(device);
+        device->SetReceiveCallback(MakeCallback(&PointToPointMultithreadedTest::RxPacket, this));
+        devices.push_back(device);
+    }
+    for (uint32_t i = 0; i < 20; ++i)
+    {
+        Ptr<PointToPointNetDevice> device = devices[i % 2];
+        Simulator::ScheduleWithContext(device->GetNode()->GetId(),
+                                       MicroSeconds(300 * i),
+                                       &PointToPointMultithreadedTest::Send,
+                                       this,
+                                       device,
+                                       100 + 10 * i);
+    }
+    Simulator::Run();
+    Simulator::Destroy();
+    return m_received;
+}
+
+void
+PointToPointMultithreadedTest::DoRun()
+{
+    ObjectFactory factory;
+    factory.SetTypeId("ns3::DefaultSimulatorImpl");
+    auto expected = Exchange(factory.Create<SimulatorImpl>());
+
+    factory.SetTypeId(MultithreadedSimulatorImpl::GetTypeId());
+    auto impl = factory.Create<MultithreadedSimulatorImpl>();
+    auto actual = Exchange(impl);
+
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(), MilliSeconds(2), "Lookahead not bounded");
+    NS_TEST_EXPECT_MSG_EQ(expected.size(), 20, "Wrong number of packets received");
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    NS_TEST_EXPECT_MSG_EQ((actual == expected), true, "Packets received at different times");
+}
+
 /**
  * @brief TestSuite for PointToPoint module
  */
@@ -144,6 +274,7 @@ PointToPointTestSuite::PointToPointTestSuite()
     : TestSuite("devices-point-to-point", Type::UNIT)
 {
     AddTestCase(new PointToPointTest, TestCase::Duration::QUICK);
+    AddTestCase(new PointToPointMultithreadedTest, TestCase::Duration::QUICK);
 }
 
 static PointToPointTestSuite g_pointToPointTestSuite; //!< The testsuite
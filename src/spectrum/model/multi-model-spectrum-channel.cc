@@ -19,6 +19,7 @@
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
+#include "ns3/multithreaded-simulator-impl.h"
 #include "ns3/net-device.h"
 #include "ns3/node.h"
 #include "ns3/object.h"
@@ -138,6 +139,8 @@ MultiModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
     RemoveRx(phy);
 
     ++m_numDevices;
+    // The propagation delay vanishes when the nodes are close to each other.
+    MultithreadedSimulatorImpl::BoundSimulatorLookAhead(Seconds(0));
 
     auto [rxInfoIterator, inserted] =
         m_rxSpectrumModelInfoMap.emplace(rxSpectrumModelUid, RxSpectrumModelInfo(rxSpectrumModel));
@@ -18,6 +18,7 @@
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
+#include "ns3/multithreaded-simulator-impl.h"
 #include "ns3/net-device.h"
 #include "ns3/node.h"
 #include "ns3/object.h"
@@ -79,6 +80,8 @@ SingleModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
     if (std::find(m_phyList.cbegin(), m_phyList.cend(), phy) == m_phyList.cend())
     {
         m_phyList.push_back(phy);
+        // The propagation delay vanishes when the nodes are close to each other.
+        MultithreadedSimulatorImpl::BoundSimulatorLookAhead(Seconds(0));
     }
     else
     {
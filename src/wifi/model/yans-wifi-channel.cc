@@ -16,6 +16,7 @@
 
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
+#include "ns3/multithreaded-simulator-impl.h"
 #include "ns3/node.h"
 #include "ns3/pointer.h"
 #include "ns3/propagation-delay-model.h"
@@ -158,6 +159,8 @@ YansWifiChannel::Add(Ptr<YansWifiPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
     m_phyList.push_back(phy);
+    // The propagation delay vanishes when the nodes are close to each other.
+    MultithreadedSimulatorImpl::BoundSimulatorLookAhead(Seconds(0));
 }
 
 int64_t
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+
+#include <iomanip>
+#include <iostream>
+
+/**
+ * @file
+ * Benchmark the rate of scheduling and running events.
+ *
+ * Each kind of event (class method, function pointer and lambda) is run
+ * separately: a fixed population of events is kept in the scheduler, each
+ * event scheduling the next one until the total number of events is reached.
+ * The rate mostly depends on the cost of creating and releasing the events.
+ */
+
+using namespace ns3;
+
+/** Number of events to run in each benchmark. */
+uint64_t g_total = 0;
+/** Number of events run so far. */
+uint64_t g_count = 0;
+
+/** A small payload, bound to the events as an argument. */
+struct Payload
+{
+    uint64_t a; //!< Some data.
+    uint64_t b; //!< More data.
+};
+
+/**
+ * Event from a function pointer.
+ * @param [in] payload The bound payload.
+ */
+void
+FunctionEvent(Payload payload)
+{
+    if (++g_count < g_total)
+    {
+        payload.a++;
+        Simulator::Schedule(NanoSeconds(payload.a % 1000), &FunctionEvent, payload);
+    }
+}
+
+/** Events from class methods. */
+class MemberBench
+{
+  public:
+    /**
+     * Event from a class method.
+     * @param [in] seq A sequence number.
+     * @param [in] payload The bound payload.
+     */
+    void Event(uint32_t seq, Payload payload)
+    {
+        if (++g_count < g_total)
+        {
+            Simulator::Schedule(NanoSeconds(seq % 1000),
+                                &MemberBench::Event,
+                                this,
+                                seq + 1,
+                                payload);
+        }
+    }
+};
+
+/**
+ * Schedule an event from a lambda.
+ * @param [in] payload The payload captured by the lambda.
+ */
+void
+ScheduleLambda(Payload payload)
+{
+    Simulator::Schedule(NanoSeconds(payload.a % 1000), [payload]() {
+        if (++g_count < g_total)
+        {
+            ScheduleLambda({payload.a + 1, payload.b});
+        }
+    });
+}
+
+/**
+ * Run one benchmark and print the event rate.
+ * @param [in] name The name of the event kind.
+ * @param [in] population The number of events kept in the scheduler.
+ * @param [in] schedule Schedule one initial event.
+ */
+void
+Run(const std::string& name, uint64_t population, const std::function<void()>& schedule)
+{
+    g_count = 0;
+    SystemWallClockMs timer;
+    timer.Start();
+    for (uint64_t i = 0; i < population; ++i)
+    {
+        schedule();
+    }
+    Simulator::Run();
+    double seconds = timer.End() / 1000.0;
+    Simulator::Destroy();
+    std::cout << std::left << std::setw(10) << name << std::right << std::setw(12) << g_count
+              << std::setw(16) << std::fixed << std::setprecision(0) << g_count / seconds
+              << std::setw(16) << EventImpl::GetPoolReservedBytes() << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t population = 10000;
+    g_total = 10000000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("population", "Number of events kept in the scheduler", population);
+    cmd.AddValue("total", "Number of events to run per event kind", g_total);
+    cmd.Parse(argc, argv);
+
+    MemberBench bench;
+
+    std::cout << std::left << std::setw(10) << "kind" << std::right << std::setw(12) << "events"
+              << std::setw(16) << "events/s" << std::setw(16) << "pool bytes" << std::endl;
+    Run("function", population, []() {
+        Simulator::Schedule(NanoSeconds(0), &FunctionEvent, Payload{0, 0});
+    });
+    Run("member", population, [&bench]() {
+        Simulator::Schedule(NanoSeconds(0), &MemberBench::Event, &bench, 0, Payload{0, 0});
+    });
+    Run("lambda", population, []() { ScheduleLambda(Payload{0, 0}); });
+
+    return 0;
+}
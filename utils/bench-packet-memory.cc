@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/command-line.h"
+#include "ns3/ethernet-header.h"
+#include "ns3/ethernet-trailer.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/llc-snap-header.h"
+#include "ns3/packet.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/udp-header.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * Benchmark the memory used by the packets of many flows.
+ *
+ * Each flow holds a window of packets with a virtual payload, created with
+ * Packet(size), in the forms they take while they cross the stack: the
+ * packet with its UDP, IPv4 and LLC headers, as queued by the MAC, an
+ * aggregate subframe built from a copy of it, with an Ethernet header, an
+ * FCS trailer and padding, and the datagram reassembled from its IPv4
+ * fragments.
+ * The resident set size of the process is reported before and after the
+ * packets are created, on Linux:
+ * @verbatim
+   bench-packet-memory --flows=10000 --window=8 --size=1400 \endverbatim
+ * As long as the payloads are not read, their bytes are not allocated, and
+ * the memory used per packet does not depend on the payload size.
+ */
+
+using namespace ns3;
+
+/**
+ * Get a memory size of this process, from /proc/self/status.
+ *
+ * @param [in] name The name of the size, such as VmRSS.
+ * @returns The size, in kB, or 0 if it is not available.
+ */
+static uint64_t
+GetMemory(const std::string& name)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, name.size() + 1, name + ":") == 0)
+        {
+            return std::stoull(line.substr(name.size() + 1));
+        }
+    }
+    return 0;
+}
+
+/** The packets of a flow. */
+struct Flow
+{
+    std::vector<Ptr<Packet>> queued;      //!< The packets queued by the MAC.
+    std::vector<Ptr<Packet>> subframes;   //!< The aggregate subframes.
+    std::vector<Ptr<Packet>> reassembled; //!< The packets reassembled from their fragments.
+};
+
+/**
+ * Create a packet of a flow.
+ *
+ * @param [in] flow The flow.
+ * @param [in] size The payload size.
+ * @param [in] mtu The size of the IPv4 fragments.
+ */
+static void
+AddPacket(Flow& flow, uint32_t size, uint32_t mtu)
+{
+    Ptr<Packet> packet = Create<Packet>(size);
+    UdpHeader udp;
+    udp.SetSourcePort(49153);
+    udp.SetDestinationPort(9);
+    packet->AddHeader(udp);
+    Ipv4Header ipv4;
+    ipv4.SetPayloadSize(packet->GetSize());
+    ipv4.SetTtl(64);
+    ipv4.SetProtocol(17);
+    Ptr<Packet> datagram = packet->Copy();
+    packet->AddHeader(ipv4);
+    LlcSnapHeader llc;
+    llc.SetType(0x0800);
+    packet->AddHeader(llc);
+    flow.queued.push_back(packet);
+
+    // An aggregate subframe, padded to a multiple of 4 bytes.
+    Ptr<Packet> subframe = packet->Copy();
+    EthernetHeader mac;
+    subframe->AddHeader(mac);
+    EthernetTrailer fcs;
+    fcs.EnableFcs(true);
+    fcs.CalcFcs(subframe);
+    subframe->AddTrailer(fcs);
+    uint32_t padding = (4 - subframe->GetSize() % 4) % 4;
+    if (padding > 0)
+    {
+        subframe->AddAtEnd(Create<Packet>(padding));
+    }
+    flow.subframes.push_back(subframe);
+
+    // The datagram, fragmented and reassembled.
+    uint32_t fragmentSize = (mtu - ipv4.GetSerializedSize()) & ~0x7;
+    Ptr<Packet> reassembled = datagram->CreateFragment(0, std::min(fragmentSize, size));
+    for (uint32_t offset = fragmentSize; offset < datagram->GetSize(); offset += fragmentSize)
+    {
+        uint32_t length = std::min(fragmentSize, datagram->GetSize() - offset);
+        reassembled->AddAtEnd(datagram->CreateFragment(offset, length));
+    }
+    flow.reassembled.push_back(reassembled);
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t flows = 10000;
+    uint32_t window = 8;
+    uint32_t size = 1400;
+    uint32_t mtu = 576;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("flows", "Number of flows", flows);
+    cmd.AddValue("window", "Number of packets held per flow", window);
+    cmd.AddValue("size", "Payload size of the packets", size);
+    cmd.AddValue("mtu", "MTU used to fragment the IPv4 datagrams", mtu);
+    cmd.Parse(argc, argv);
+
+    uint64_t rssBefore = GetMemory("VmRSS");
+    SystemWallClockMs timer;
+    timer.Start();
+    std::vector<Flow> all(flows);
+    for (auto& flow : all)
+    {
+        for (uint32_t i = 0; i < window; ++i)
+        {
+            AddPacket(flow, size, mtu);
+        }
+    }
+    double ms = timer.End();
+    uint64_t rssAfter = GetMemory("VmRSS");
+
+    uint64_t packets = uint64_t(flows) * window;
+    uint64_t bytes = 0;
+    for (const auto& flow : all)
+    {
+        for (const auto& packet : flow.subframes)
+        {
+            bytes += packet->GetSize();
+        }
+    }
+    std::cout << std::left << std::setw(16) << "flows" << flows << '\n'
+              << std::setw(16) << "packets" << packets << " x 3\n"
+              << std::setw(16) << "subframe bytes" << bytes << '\n'
+              << std::setw(16) << "rss before" << rssBefore << " kB\n"
+              << std::setw(16) << "rss after" << rssAfter << " kB\n"
+              << std::setw(16) << "rss per packet" << (rssAfter - rssBefore) * 1024 / packets
+              << " B\n"
+              << std::setw(16) << "peak rss" << GetMemory("VmHWM") << " kB\n"
+              << std::setw(16) << "run time" << ms << " ms" << std::endl;
+
+    return 0;
+}
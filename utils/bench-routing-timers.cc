@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/aodv-module.h"
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/dsdv-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/olsr-module.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+/**
+ * @file
+ * Benchmark the coalescing of the periodic timers in a routing scenario.
+ *
+ * The nodes of an 802.11b ad hoc network, placed on a grid, run OLSR,
+ * AODV or DSDV, and some of them send constant bit rate UDP flows to
+ * others, started at the same time.  The \c TimerCoalescing attribute of
+ * the routing protocol and of the UdpClient applications is set by the
+ * \c --coalescing option, so that the event counts and the run time of
+ * the simulation can be compared with and without coalescing:
+ * @verbatim
+   bench-routing-timers --protocol=olsr --coalescing=0
+   bench-routing-timers --protocol=olsr --coalescing=1 \endverbatim
+ * The number of received packets should not depend on the coalescing
+ * with the default zero \c --granularity.
+ */
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    std::string protocol = "olsr";
+    uint32_t nodes = 49;
+    double spacing = 50;
+    uint32_t flows = 10;
+    Time interval = MilliSeconds(100);
+    Time duration = Seconds(60);
+    bool coalescing = false;
+    Time granularity = Seconds(0);
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("protocol", "Routing protocol: olsr, aodv or dsdv", protocol);
+    cmd.AddValue("nodes", "Number of nodes, placed on a square grid", nodes);
+    cmd.AddValue("spacing", "Distance between the neighbor nodes of the grid, in m", spacing);
+    cmd.AddValue("flows", "Number of UDP flows", flows);
+    cmd.AddValue("interval", "Interval between the packets of a flow", interval);
+    cmd.AddValue("duration", "Simulated time", duration);
+    cmd.AddValue("coalescing", "Whether the timers are coalesced", coalescing);
+    cmd.AddValue("granularity", "The TimerCoalescingGranularity", granularity);
+    cmd.Parse(argc, argv);
+
+    Config::SetDefault("ns3::olsr::RoutingProtocol::TimerCoalescing", BooleanValue(coalescing));
+    Config::SetDefault("ns3::aodv::RoutingProtocol::TimerCoalescing", BooleanValue(coalescing));
+    Config::SetDefault("ns3::dsdv::RoutingProtocol::TimerCoalescing", BooleanValue(coalescing));
+    Config::SetDefault("ns3::UdpClient::TimerCoalescing", BooleanValue(coalescing));
+    Config::SetGlobal("TimerCoalescingGranularity", TimeValue(granularity));
+
+    NodeContainer adhocNodes;
+    adhocNodes.Create(nodes);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211b);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("DsssRate11Mbps"),
+                                 "ControlMode",
+                                 StringValue("DsssRate11Mbps"));
+    YansWifiChannelHelper wifiChannel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper wifiPhy;
+    wifiPhy.SetChannel(wifiChannel.Create());
+    WifiMacHelper wifiMac;
+    wifiMac.SetType("ns3::AdhocWifiMac");
+    NetDeviceContainer devices = wifi.Install(wifiPhy, wifiMac, adhocNodes);
+
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator("ns3::GridPositionAllocator",
+                                  "DeltaX",
+                                  DoubleValue(spacing),
+                                  "DeltaY",
+                                  DoubleValue(spacing),
+                                  "GridWidth",
+                                  UintegerValue(std::ceil(std::sqrt(nodes))));
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(adhocNodes);
+
+    AodvHelper aodv;
+    OlsrHelper olsr;
+    DsdvHelper dsdv;
+    Ipv4ListRoutingHelper list;
+    if (protocol == "olsr")
+    {
+        list.Add(olsr, 100);
+    }
+    else if (protocol == "aodv")
+    {
+        list.Add(aodv, 100);
+    }
+    else if (protocol == "dsdv")
+    {
+        list.Add(dsdv, 100);
+    }
+    else
+    {
+        NS_FATAL_ERROR("No such protocol: " << protocol);
+    }
+    InternetStackHelper internet;
+    internet.SetRoutingHelper(list);
+    internet.Install(adhocNodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.0.0", "255.255.0.0");
+    Ipv4InterfaceContainer interfaces = address.Assign(devices);
+
+    // The flows cross the grid, and start once the routes are set up.
+    const uint16_t port = 9;
+    UdpServerHelper server(port);
+    UdpClientHelper client;
+    client.SetAttribute("MaxPackets", UintegerValue(0));
+    client.SetAttribute("Interval", TimeValue(interval));
+    client.SetAttribute("PacketSize", UintegerValue(512));
+    ApplicationContainer servers;
+    ApplicationContainer clients;
+    for (uint32_t i = 0; i < flows && i < nodes / 2; ++i)
+    {
+        uint32_t sink = nodes - 1 - i;
+        servers.Add(server.Install(adhocNodes.Get(sink)));
+        client.SetAttribute("Remote",
+                            AddressValue(InetSocketAddress(interfaces.GetAddress(sink), port)));
+        clients.Add(client.Install(adhocNodes.Get(i)));
+    }
+    servers.Start(Seconds(0));
+    clients.Start(Seconds(10));
+    clients.Stop(duration);
+
+    SystemWallClockMs timer;
+    Simulator::Stop(duration);
+    timer.Start();
+    Simulator::Run();
+    double ms = timer.End();
+
+    uint64_t received = 0;
+    for (auto it = servers.Begin(); it != servers.End(); ++it)
+    {
+        received += DynamicCast<UdpServer>(*it)->GetReceived();
+    }
+    uint64_t coalesced = TimerCoalescer::GetEventCount();
+    uint64_t buckets = TimerCoalescer::GetBucketCount();
+    std::cout << std::left << std::setw(12) << "protocol" << protocol << '\n'
+              << std::setw(12) << "coalescing" << (coalescing ? "on" : "off") << '\n'
+              << std::setw(12) << "events" << Simulator::GetEventCount() << '\n'
+              << std::setw(12) << "coalesced" << coalesced << " in " << buckets
+              << " scheduler events\n"
+              << std::setw(12) << "received" << received << '\n'
+              << std::setw(12) << "run time" << ms << " ms" << std::endl;
+    Simulator::Destroy();
+
+    return 0;
+}
@@ -373,6 +373,35 @@ BenchSuite::Log() const
     LOG("");
 }
 
+/**
+ *  Create a RandomVariableStream mixing two time scales, as seen in
+ *  wireless simulations: most events are PHY/MAC events a few
+ *  microseconds apart, the others are application or protocol timers
+ *  firing about every second.
+ *
+ *  @returns The RandomVariableStream.
+ */
+Ptr<RandomVariableStream>
+GetSkewedStream()
+{
+    LOG("  Event time distribution:      skewed (90% uniform 1-20 us, 10% exponential 1 s)");
+    auto choice = CreateObject<UniformRandomVariable>();
+    auto burst = CreateObject<UniformRandomVariable>();
+    burst->SetAttribute("Min", DoubleValue(1000));
+    burst->SetAttribute("Max", DoubleValue(20000));
+    auto timer = CreateObject<ExponentialRandomVariable>();
+    timer->SetAttribute("Mean", DoubleValue(1e9));
+
+    std::vector<double> nsValues(100000);
+    for (auto& value : nsValues)
+    {
+        value = (choice->GetValue() < 0.9) ? burst->GetValue() : timer->GetValue();
+    }
+    auto drv = CreateObject<DeterministicRandomVariable>();
+    drv->SetValueArray(&nsValues[0], nsValues.size());
+    return drv;
+}
+
 /**
  *  Create a RandomVariableStream to generate next event delays.
  *
@@ -382,14 +411,20 @@ BenchSuite::Log() const
  *  If the \p filename is `-` standard input will be used.
  *
  *  @param [in] filename The delay interval source file name.
+ *  @param [in] skewed Whether to use the skewed distribution instead of
+ *              the default exponential one.
  *  @returns The RandomVariableStream.
  */
 Ptr<RandomVariableStream>
-GetRandomStream(std::string filename)
+GetRandomStream(std::string filename, bool skewed)
 {
     Ptr<RandomVariableStream> stream = nullptr;
 
-    if (filename.empty())
+    if (filename.empty() && skewed)
+    {
+        stream = GetSkewedStream();
+    }
+    else if (filename.empty())
     {
         LOG("  Event time distribution:      default exponential");
         auto erv = CreateObject<ExponentialRandomVariable>();
@@ -443,6 +478,7 @@ main(int argc, char* argv[])
     bool allSched = false;
     bool schedCal = false;
     bool schedHeap = false;
+    bool schedLadder = false;
     bool schedList = false;
     bool schedMap = false; // default scheduler
     bool schedPQ = false;
@@ -452,12 +488,14 @@ main(int argc, char* argv[])
     uint64_t runs = 1;
     std::string filename = "";
     bool calRev = false;
+    bool skewed = false;
 
     CommandLine cmd(__FILE__);
     cmd.Usage("Benchmark the simulator scheduler.\n"
               "\n"
               "Event intervals are taken from one of:\n"
               "  an exponential distribution, with mean 100 ns,\n"
+              "  a skewed mix of microsecond bursts and second-scale timers, with --skewed,\n"
               "  an ascii file, given by the --file=\"<filename>\" argument,\n"
               "  or standard input, by the argument --file=\"-\"\n"
               "In the case of either --file form, the input is expected\n"
@@ -468,6 +506,7 @@ main(int argc, char* argv[])
     cmd.AddValue("cal", "use CalendarScheduler", schedCal);
     cmd.AddValue("calrev", "reverse ordering in the CalendarScheduler", calRev);
     cmd.AddValue("heap", "use HeapScheduler", schedHeap);
+    cmd.AddValue("ladder", "use LadderScheduler", schedLadder);
     cmd.AddValue("list", "use ListScheduler", schedList);
     cmd.AddValue("map", "use MapScheduler (default)", schedMap);
     cmd.AddValue("pri", "use PriorityQueue", schedPQ);
@@ -476,6 +515,7 @@ main(int argc, char* argv[])
     cmd.AddValue("total", "total number of events to run", total);
     cmd.AddValue("runs", "number of runs", runs);
     cmd.AddValue("file", "file of relative event times", filename);
+    cmd.AddValue("skewed", "use the skewed event time distribution", skewed);
     cmd.AddValue("prec", "printed output precision", g_fwidth);
     cmd.Parse(argc, argv);
 
@@ -491,15 +531,15 @@ main(int argc, char* argv[])
 
     if (allSched)
     {
-        schedCal = schedHeap = schedList = schedMap = schedPQ = true;
+        schedCal = schedHeap = schedLadder = schedList = schedMap = schedPQ = true;
     }
     // Set the default case if nothing else is set
-    if (!(schedCal || schedHeap || schedList || schedMap || schedPQ))
+    if (!(schedCal || schedHeap || schedLadder || schedList || schedMap || schedPQ))
     {
         schedMap = true;
     }
 
-    auto eventStream = GetRandomStream(filename);
+    auto eventStream = GetRandomStream(filename, skewed);
 
     ObjectFactory factory("ns3::MapScheduler");
     if (schedCal)
@@ -518,6 +558,11 @@ main(int argc, char* argv[])
         factory.SetTypeId("ns3::HeapScheduler");
         BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
     }
+    if (schedLadder)
+    {
+        factory.SetTypeId("ns3::LadderScheduler");
+        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+    }
     if (schedList)
     {
         factory.SetTypeId("ns3::ListScheduler");
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * @file
+ * Benchmark the Time arithmetic and unit conversions.
+ *
+ * Each operation is run on a table of Times, spread from picoseconds to
+ * hundreds of seconds, and its cost per operation is printed.  The
+ * \c phy operation mimics the duration computations of the wifi PHYs:
+ * a number of symbols times a symbol duration, computed in femtoseconds,
+ * plus the preamble, then converted to seconds.
+ */
+
+using namespace ns3;
+
+/** Accumulates the results, so that the operations are not optimized out. */
+volatile int64_t g_sink = 0;
+
+/**
+ * Run one operation over the table of Times and print its cost.
+ * @param [in] name The name of the operation.
+ * @param [in] iterations The number of times each Time is used.
+ * @param [in] times The table of Times.
+ * @param [in] op The operation, returning a value to accumulate.
+ */
+void
+Run(const std::string& name,
+    uint32_t iterations,
+    const std::vector<Time>& times,
+    const std::function<int64_t(const Time&, const Time&)>& op)
+{
+    int64_t sink = 0;
+    SystemWallClockMs timer;
+    timer.Start();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        for (std::size_t j = 1; j < times.size(); ++j)
+        {
+            sink += op(times[j - 1], times[j]);
+        }
+    }
+    double ms = timer.End();
+    g_sink = g_sink + sink;
+    double count = static_cast<double>(iterations) * (times.size() - 1);
+    std::cout << std::left << std::setw(14) << name << std::right << std::setw(14)
+              << static_cast<uint64_t>(count) << std::setw(12) << std::fixed
+              << std::setprecision(2) << ms * 1e6 / count << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t size = 1000;
+    uint32_t iterations = 10000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("size", "Number of Times in the table", size);
+    cmd.AddValue("iterations", "Number of passes over the table", iterations);
+    cmd.Parse(argc, argv);
+
+    Ptr<UniformRandomVariable> exponent = CreateObject<UniformRandomVariable>();
+    std::vector<Time> times;
+    std::vector<double> seconds;
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        double value = std::pow(10.0, exponent->GetValue(-6, 2));
+        times.push_back(Seconds(value));
+        seconds.push_back(value);
+    }
+
+    // Run in an event, as the models do: the Times created before Simulator::Run() are
+    // recorded, in case the resolution changes, which would dominate the costs.
+    Simulator::ScheduleNow([&]() {
+        std::cout << std::left << std::setw(14) << "operation" << std::right << std::setw(14)
+                  << "ops" << std::setw(12) << "ns/op" << std::endl;
+        Run("add-compare", iterations, times, [](const Time& a, const Time& b) {
+            Time sum = a + b;
+            return (sum > a) + (a < b) + (Max(a, b) == b) + (sum - b).GetTimeStep();
+        });
+        Run("scale-int", iterations, times, [](const Time& a, const Time& b) {
+            return (a * 3 + b / 7).GetTimeStep();
+        });
+        Run("scale-double", iterations, times, [](const Time& a, const Time& b) {
+            return (a * 0.3 + b / 1.5).GetTimeStep();
+        });
+        Run("ratio", iterations, times, [](const Time& a, const Time& b) {
+            return (a / b).GetHigh();
+        });
+        std::size_t index = 0;
+        Run("Seconds()", iterations, times, [&seconds, &index](const Time&, const Time&) {
+            index = (index + 1) % seconds.size();
+            return Seconds(seconds[index]).GetTimeStep();
+        });
+        Run("GetSeconds()", iterations, times, [](const Time& a, const Time& b) {
+            return static_cast<int64_t>(a.GetSeconds() + b.GetSeconds());
+        });
+        Run("integer-units", iterations, times, [](const Time& a, const Time& b) {
+            return a.GetMicroSeconds() + b.GetFemtoSeconds();
+        });
+        Run("phy", iterations, times, [](const Time& a, const Time& b) {
+            Time symbolDuration = MicroSeconds(4);
+            auto numSymbols = static_cast<uint64_t>(a.GetTimeStep() % 1000);
+            Time payload = FemtoSeconds(numSymbols * symbolDuration.GetFemtoSeconds());
+            Time duration = MicroSeconds(16) + MicroSeconds(4) + payload;
+            return static_cast<int64_t>(duration.GetSeconds() * 1e9) + (duration < b);
+        });
+    });
+    Simulator::Run();
+    Simulator::Destroy();
+
+    return 0;
+}